@@ -11,14 +11,20 @@
 
 #include <tao/pq/connection.hpp>
 #include <tao/pq/connection_pool.hpp>
+#include <tao/pq/pool_statistics.hpp>
+#include <tao/pq/prepared_statement.hpp>
+#include <tao/pq/replicated_pool.hpp>
+#include <tao/pq/sharded_pool.hpp>
 #include <tao/pq/transaction.hpp>
 
 #include <tao/pq/parameter_traits.hpp>
 #include <tao/pq/parameter_traits_array.hpp>
+#include <tao/pq/parameter_traits_binary.hpp>
 #include <tao/pq/parameter_traits_optional.hpp>
 #include <tao/pq/parameter_traits_pair.hpp>
 #include <tao/pq/parameter_traits_tuple.hpp>
 
+#include <tao/pq/column_ref.hpp>
 #include <tao/pq/exception.hpp>
 #include <tao/pq/result.hpp>
 
@@ -28,6 +34,12 @@
 #include <tao/pq/result_traits_pair.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
 
+#include <tao/pq/async_connection.hpp>
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/cursor.hpp>
+#include <tao/pq/pipeline.hpp>
+#include <tao/pq/row_stream.hpp>
+
 #include <tao/pq/table_reader.hpp>
 #include <tao/pq/table_writer.hpp>
 
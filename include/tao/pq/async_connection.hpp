@@ -0,0 +1,71 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_ASYNC_CONNECTION_HPP
+#define TAO_PQ_ASYNC_CONNECTION_HPP
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+
+namespace tao::pq
+{
+   // a connection which is being established without blocking
+   class async_connection final
+   {
+   private:
+      friend class connection;
+      friend class connection_pool;
+
+      std::unique_ptr< PGconn, decltype( &PQfinish ) > m_pgconn;
+      PostgresPollingStatusType m_status = PGRES_POLLING_WRITING;
+      std::chrono::steady_clock::time_point m_deadline = std::chrono::steady_clock::time_point::max();
+
+      explicit async_connection( const std::string& connection_info );
+
+      void check_pending() const;
+
+      // milliseconds until connect_timeout expires, -1 without a timeout, throws when expired
+      [[nodiscard]] auto remaining_ms() const -> int;
+
+      // advances the connection, only called when the socket is ready
+      void advance();
+
+      [[nodiscard]] auto release() -> PGconn*;
+
+   public:
+      ~async_connection() = default;
+
+      async_connection( const async_connection& ) = delete;
+      async_connection( async_connection&& ) noexcept = default;
+      void operator=( const async_connection& ) = delete;
+      void operator=( async_connection&& ) = delete;
+
+      [[nodiscard]] auto is_pending() const noexcept -> bool
+      {
+         return static_cast< bool >( m_pgconn );
+      }
+
+      [[nodiscard]] auto socket() const -> int;
+
+      [[nodiscard]] auto wants_write() const noexcept -> bool
+      {
+         return m_status == PGRES_POLLING_WRITING;
+      }
+
+      // non-blocking, returns true when the connection is established,
+      // throws when the connection failed or connect_timeout expired
+      [[nodiscard]] auto ready() -> bool;
+
+      // blocks until the connection is established or connect_timeout expired
+      [[nodiscard]] auto get() -> std::shared_ptr< connection >;
+   };
+
+}  // namespace tao::pq
+
+#endif
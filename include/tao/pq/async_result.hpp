@@ -0,0 +1,69 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_ASYNC_RESULT_HPP
+#define TAO_PQ_ASYNC_RESULT_HPP
+
+#include <memory>
+#include <utility>
+
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   class async_result final
+   {
+   protected:
+      std::shared_ptr< transaction > m_previous;
+      std::shared_ptr< transaction > m_transaction;
+      bool m_flushed = false;
+
+      void check_pending() const;
+
+   public:
+      template< typename... As >
+      async_result( const std::shared_ptr< transaction >& transaction, const internal::zsv statement, As&&... as )
+         : m_previous( transaction ),
+           m_transaction( std::make_shared< internal::transaction_guard >( transaction->connection() ) )
+      {
+         m_transaction->send( statement, std::forward< As >( as )... );
+      }
+
+      ~async_result();
+
+      async_result( const async_result& ) = delete;
+      async_result( async_result&& ) noexcept = default;
+      void operator=( const async_result& ) = delete;
+      void operator=( async_result&& ) = delete;
+
+      [[nodiscard]] auto is_pending() const noexcept -> bool
+      {
+         return static_cast< bool >( m_transaction );
+      }
+
+      [[nodiscard]] auto connection() const -> const std::shared_ptr< pq::connection >&;
+      [[nodiscard]] auto socket() const -> int;
+
+      [[nodiscard]] auto wants_write() const noexcept -> bool
+      {
+         return !m_flushed;
+      }
+
+      [[nodiscard]] auto ready() -> bool;
+      [[nodiscard]] auto get() -> result;
+   };
+
+   // implemented here as we need the complete type of async_result
+   template< typename... As >
+   auto transaction::async_execute( const internal::zsv statement, As&&... as ) -> async_result
+   {
+      check_current_transaction();
+      return async_result( shared_from_this(), statement, std::forward< As >( as )... );
+   }
+
+}  // namespace tao::pq
+
+#endif
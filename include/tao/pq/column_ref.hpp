@@ -0,0 +1,32 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_COLUMN_REF_HPP
+#define TAO_PQ_COLUMN_REF_HPP
+
+#include <string>
+#include <string_view>
+
+namespace tao::pq
+{
+   // a column name that is prepared once and can be reused for lookups in many rows/results,
+   // the name is interpreted like PQfnumber() does, i.e. unquoted parts are folded to lower case
+   class column_ref final
+   {
+   private:
+      std::string m_name;
+
+   public:
+      explicit column_ref( const std::string_view in_name );
+
+      // the name as it is expected to be returned from the server
+      [[nodiscard]] auto name() const noexcept -> const std::string&
+      {
+         return m_name;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -5,13 +5,16 @@
 #ifndef TAO_PQ_CONNECTION_HPP
 #define TAO_PQ_CONNECTION_HPP
 
+#include <cstddef>
 #include <functional>
+#include <list>
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -20,30 +23,77 @@
 #include <tao/pq/isolation_level.hpp>
 #include <tao/pq/notification.hpp>
 #include <tao/pq/oid.hpp>
+#include <tao/pq/pipeline_status.hpp>
+#include <tao/pq/prepared_statement.hpp>
 #include <tao/pq/result.hpp>
+#include <tao/pq/result_format.hpp>
 #include <tao/pq/transaction.hpp>
 
 namespace tao::pq
 {
+   class async_connection;
    class connection_pool;
 
    class connection final
       : public std::enable_shared_from_this< connection >
    {
    private:
+      friend class async_connection;
+      friend class async_result;
       friend class connection_pool;
       friend class transaction;
 
       const std::unique_ptr< PGconn, decltype( &PQfinish ) > m_pgconn;
       pq::transaction* m_current_transaction;
-      std::set< std::string, std::less<> > m_prepared_statements;
+      pq::result_format m_result_format = pq::result_format::text_format;
+
+      // the names and texts of the prepared statements, the index refers to the entries in the list
+      std::list< std::pair< std::string, std::string > > m_prepared_texts;
+      std::unordered_map< std::string_view, std::list< std::pair< std::string, std::string > >::iterator > m_prepared_statements;
+      std::size_t m_prepared_name_size = 0;
+
+      struct auto_prepared_statement
+      {
+         std::string statement;
+         std::string name;
+         std::vector< Oid > types;
+         std::size_t executions;
+      };
+
+      // prepared statements and candidates which are not prepared yet, each bounded by the capacity,
+      // most recently used first, the index refers to the statements in either list
+      std::list< auto_prepared_statement > m_auto_prepared_statements;
+      std::list< auto_prepared_statement > m_auto_prepare_candidates;
+      std::unordered_map< std::string_view, std::list< auto_prepared_statement >::iterator > m_auto_prepared_index;
+      std::size_t m_auto_prepare_threshold = 0;
+      std::size_t m_auto_prepare_capacity = 0;
+      std::size_t m_auto_prepare_counter = 0;
+
+      // evicted statements which are deallocated on the server when the connection is idle
+      std::vector< std::string > m_evicted_statements;
+
+      // the generation of the pinned statements of a connection pool prepared on this connection
+      std::size_t m_pool_generation = 0;
+
       std::function< void( const notification& ) > m_notification_handler;
       std::map< std::string, std::function< void( const char* ) >, std::less<> > m_notification_handlers;
 
       [[nodiscard]] auto escape_identifier( const std::string_view identifier ) const -> std::string;
 
       static void check_prepared_name( const std::string_view name );
-      [[nodiscard]] auto is_prepared( const std::string_view name ) const noexcept -> bool;
+      [[nodiscard]] auto is_prepared( const char* name ) const noexcept -> bool;
+      [[nodiscard]] auto prepared_text( const std::string_view name ) const noexcept -> const std::string*;
+
+      [[nodiscard]] auto auto_prepare( const char* statement, const int n_params, const Oid types[] ) -> const char*;
+      void auto_evict();
+      void auto_evict_candidate() noexcept;
+      void deallocate_evicted();
+
+      // after the server discarded all prepared statements, e.g. by "DISCARD ALL"
+      void forget_prepared_statements() noexcept;
+
+      // disables automatically prepared statements, the statements are deallocated later
+      void reset_auto_prepare() noexcept;
 
       [[nodiscard]] auto execute_final( const result::mode_t mode,
                                         const char* statement,
@@ -61,12 +111,31 @@ namespace tao::pq
                                          const int lengths[],
                                          const int formats[] ) -> result;
 
+      [[nodiscard]] auto execute_prepared( const result::mode_t mode,
+                                           const char* name,
+                                           const int n_params,
+                                           const char* const values[],
+                                           const int lengths[],
+                                           const int formats[] ) -> result;
+
       [[nodiscard]] auto execute_single( const internal::zsv statement ) -> result;
 
+      [[nodiscard]] auto prepare_described( const std::string& name, const std::string& statement, const std::size_t parameters ) -> std::vector< Oid >;
+
+      void send_params( const char* statement,
+                        const int n_params,
+                        const Oid types[],
+                        const char* const values[],
+                        const int lengths[],
+                        const int formats[] );
+
+      [[nodiscard]] auto get_result( const result::mode_t mode ) -> result;
+
       // pass-key idiom
       class private_key final
       {
          private_key() = default;
+         friend class async_connection;
          friend class connection;
          friend class connection_pool;
       };
@@ -74,6 +143,9 @@ namespace tao::pq
    public:
       explicit connection( const private_key /*unused*/, const std::string& connection_info );
 
+      // takes ownership of an already established connection
+      connection( const private_key /*unused*/, PGconn* pgconn );
+
       connection( const connection& ) = delete;
       connection( connection&& ) = delete;
       void operator=( const connection& ) = delete;
@@ -83,6 +155,9 @@ namespace tao::pq
 
       [[nodiscard]] static auto create( const std::string& connection_info ) -> std::shared_ptr< connection >;
 
+      // establishes the connection without blocking, see async_connection.hpp
+      [[nodiscard]] static auto create_async( const std::string& connection_info ) -> async_connection;
+
       [[nodiscard]] auto error_message() const -> std::string;
 
       [[nodiscard]] auto notification_handler() const -> std::function< void( const notification& ) >;
@@ -96,6 +171,25 @@ namespace tao::pq
 
       [[nodiscard]] auto is_open() const noexcept -> bool;
 
+      [[nodiscard]] auto result_format() const noexcept -> pq::result_format
+      {
+         return m_result_format;
+      }
+
+      void set_result_format( const pq::result_format format ) noexcept
+      {
+         m_result_format = format;
+      }
+
+      [[nodiscard]] auto socket() const -> int;
+
+      [[nodiscard]] auto is_nonblocking() const noexcept -> bool;
+      void set_nonblocking( const bool enable );
+
+      [[nodiscard]] auto flush() -> bool;
+      void consume_input();
+      [[nodiscard]] auto is_busy() const noexcept -> bool;
+
       [[nodiscard]] auto direct() -> std::shared_ptr< pq::transaction >;
 
       [[nodiscard]] auto transaction() -> std::shared_ptr< pq::transaction >;
@@ -105,12 +199,38 @@ namespace tao::pq
       void prepare( const std::string& name, const std::string& statement );
       void deallocate( const std::string& name );
 
+      template< typename... Ts >
+      auto prepare( const std::string& name, const std::string& statement ) -> prepared_statement< Ts... >
+      {
+         return prepared_statement< Ts... >( name, prepare_described( name, statement, ( 0 + ... + internal::prepared_parameter< Ts >::columns ) ) );
+      }
+
+      [[nodiscard]] auto auto_prepare_threshold() const noexcept -> std::size_t
+      {
+         return m_auto_prepare_threshold;
+      }
+
+      [[nodiscard]] auto auto_prepare_capacity() const noexcept -> std::size_t
+      {
+         return m_auto_prepare_capacity;
+      }
+
+      [[nodiscard]] auto auto_prepared_statements() const noexcept -> std::size_t;
+
+      void set_auto_prepare( const std::size_t threshold, const std::size_t capacity );
+
       template< typename... As >
       auto execute( const internal::zsv statement, As&&... as )
       {
          return direct()->execute( statement, std::forward< As >( as )... );
       }
 
+      template< typename... Ts, typename... As >
+      auto execute( const prepared_statement< Ts... >& statement, As&&... as )
+      {
+         return direct()->execute( statement, std::forward< As >( as )... );
+      }
+
       void listen( const std::string_view channel );
       void listen( const std::string_view channel, const std::function< void( const char* payload ) >& handler );
       void unlisten( const std::string_view channel );
@@ -121,6 +241,11 @@ namespace tao::pq
       void handle_notifications();
       void get_notifications();
 
+      [[nodiscard]] auto pipeline_status() const noexcept -> pq::pipeline_status;
+      void enter_pipeline_mode();
+      void exit_pipeline_mode();
+      void pipeline_sync();
+
       [[nodiscard]] auto underlying_raw_ptr() noexcept -> PGconn*
       {
          return m_pgconn.get();
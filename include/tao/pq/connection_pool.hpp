@@ -5,10 +5,17 @@
 #ifndef TAO_PQ_CONNECTION_POOL_HPP
 #define TAO_PQ_CONNECTION_POOL_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
 
 #include <tao/pq/connection.hpp>
 #include <tao/pq/internal/pool.hpp>
@@ -23,13 +30,28 @@ namespace tao::pq
    private:
       const std::string m_connection_info;
 
+      // statements prepared on every connection and the statement executed when a connection is returned
+      mutable std::mutex m_session_mutex;
+      std::vector< std::pair< std::string, std::string > > m_pinned_statements;
+      std::atomic< std::size_t > m_pinned_generation = 0;
+      std::shared_ptr< const std::string > m_reset_statement;
+      bool m_reset_discards_statements = false;
+
+      void prepare_pinned( pq::connection& c ) const;
+      static void prepare_pinned( pq::connection& c, const std::string& name, const std::string& statement );
+      void prepare_borrowed( const std::shared_ptr< pq::connection >& c ) const;
+
       [[nodiscard]] auto v_create() const -> std::unique_ptr< pq::connection > override;
+      [[nodiscard]] auto v_create_many( const std::size_t n ) const -> std::vector< std::unique_ptr< pq::connection > > override;
 
       [[nodiscard]] auto v_is_valid( connection& c ) const noexcept -> bool override
       {
-         return c.is_open();
+         return c.is_open() && ( PQtransactionStatus( c.underlying_raw_ptr() ) == PQTRANS_IDLE );
       }
 
+      [[nodiscard]] auto v_reset( connection& c ) const noexcept -> bool override;
+      [[nodiscard]] auto v_probe( connection& c ) const noexcept -> bool override;
+
       // pass-key idiom
       class private_key final
       {
@@ -38,11 +60,23 @@ namespace tao::pq
       };
 
    public:
-      connection_pool( const private_key /*unused*/, const std::string_view connection_info );
+      connection_pool( const private_key /*unused*/, const std::string_view connection_info, const std::size_t max_size = 0, const std::size_t min_idle = 0 );
 
       [[nodiscard]] static auto create( const std::string_view connection_info ) -> std::shared_ptr< connection_pool >;
+      [[nodiscard]] static auto create( const std::string_view connection_info, const std::size_t max_size, const std::size_t min_idle = 0 ) -> std::shared_ptr< connection_pool >;
+
+      [[nodiscard]] auto connection() -> std::shared_ptr< pq::connection >;
+      [[nodiscard]] auto connection( const std::chrono::steady_clock::duration timeout ) -> std::shared_ptr< pq::connection >;
+
+      // prepares the statement on every connection of the pool before it is borrowed,
+      // the statement is validated on a connection first and rejected if it fails to prepare
+      void prepare( const std::string& name, const std::string& statement );
+
+      [[nodiscard]] auto reset_statement() const -> std::string;
 
-      [[nodiscard]] auto connection() -> std::shared_ptr< connection >;
+      // executed whenever a connection is returned to the pool, e.g. "DISCARD TEMP", empty to disable,
+      // set discards_statements when the statement drops prepared statements, e.g. "DISCARD ALL"
+      void set_reset_statement( const std::string& statement, const bool discards_statements = false );
 
       template< typename... As >
       auto execute( const internal::zsv statement, As&&... as )
@@ -0,0 +1,531 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_COROUTINE_HPP
+#define TAO_PQ_COROUTINE_HPP
+
+#if !defined( __cpp_impl_coroutine )
+#error "tao/pq/coroutine.hpp requires C++20 coroutine support"
+#endif
+
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <list>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/async_connection.hpp>
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/connection.hpp>
+#include <tao/pq/internal/poll.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/table_reader.hpp>
+#include <tao/pq/table_writer.hpp>
+
+namespace tao::pq
+{
+   template< typename T = void >
+   class task;
+
+   namespace internal
+   {
+      // an operation on a connection which is retried whenever its socket becomes ready
+      class awaitable_operation
+      {
+      protected:
+         const std::shared_ptr< pq::connection > m_connection;
+         std::coroutine_handle<> m_handle;
+
+         explicit awaitable_operation( const std::shared_ptr< pq::connection >& connection )  // NOLINT(modernize-pass-by-value)
+            : m_connection( connection )
+         {}
+
+         ~awaitable_operation() = default;
+
+      public:
+         awaitable_operation( const awaitable_operation& ) = delete;
+         awaitable_operation( awaitable_operation&& ) = delete;
+         void operator=( const awaitable_operation& ) = delete;
+         void operator=( awaitable_operation&& ) = delete;
+
+         // returns true when the operation is complete
+         [[nodiscard]] virtual auto poll() -> bool = 0;
+
+         [[nodiscard]] virtual auto socket() const -> int
+         {
+            return m_connection->socket();
+         }
+
+         [[nodiscard]] virtual auto wants_write() const -> bool
+         {
+            return !m_connection->flush();
+         }
+
+         [[nodiscard]] auto handle() const noexcept -> std::coroutine_handle<>
+         {
+            return m_handle;
+         }
+
+         [[nodiscard]] auto await_ready() -> bool
+         {
+            return poll();
+         }
+
+         void await_suspend( const std::coroutine_handle<> handle );
+      };
+
+   }  // namespace internal
+
+   class event_loop final
+   {
+   private:
+      std::deque< std::coroutine_handle<> > m_ready;
+      std::vector< internal::awaitable_operation* > m_waiting;
+      std::list< task<> > m_spawned;
+
+      static auto current_ptr() noexcept -> event_loop*&
+      {
+         thread_local event_loop* current = nullptr;
+         return current;
+      }
+
+      void wait_for_sockets();
+      void reap_spawned();
+
+   public:
+      event_loop() = default;
+      ~event_loop() = default;
+
+      event_loop( const event_loop& ) = delete;
+      event_loop( event_loop&& ) = delete;
+      void operator=( const event_loop& ) = delete;
+      void operator=( event_loop&& ) = delete;
+
+      [[nodiscard]] static auto current() -> event_loop&
+      {
+         event_loop* loop = current_ptr();
+         if( loop == nullptr ) {
+            throw std::logic_error( "no running tao::pq::event_loop" );
+         }
+         return *loop;
+      }
+
+      void schedule( const std::coroutine_handle<> handle )
+      {
+         m_ready.push_back( handle );
+      }
+
+      void wait( internal::awaitable_operation& operation )
+      {
+         m_waiting.push_back( &operation );
+      }
+
+      // runs the task concurrently with other spawned tasks, exceptions are rethrown from run()
+      void spawn( task<>&& t );
+
+      // runs until all spawned tasks are complete
+      void run();
+
+      // runs until all spawned tasks and the given task are complete, returns the task's result
+      template< typename T >
+      auto run( task< T >&& t ) -> T;
+   };
+
+   inline void internal::awaitable_operation::await_suspend( const std::coroutine_handle<> handle )
+   {
+      m_handle = handle;
+      event_loop::current().wait( *this );
+   }
+
+   namespace internal
+   {
+      template< typename T >
+      class task_promise_result
+      {
+      protected:
+         std::optional< T > m_value;
+
+      public:
+         template< typename U >
+         void return_value( U&& value )
+         {
+            m_value.emplace( std::forward< U >( value ) );
+         }
+
+         [[nodiscard]] auto value() -> T
+         {
+            return std::move( *m_value );
+         }
+      };
+
+      template<>
+      class task_promise_result< void >
+      {
+      public:
+         void return_void() noexcept {}
+         void value() noexcept {}
+      };
+
+   }  // namespace internal
+
+   template< typename T >
+   class task final
+   {
+   public:
+      class promise_type
+         : public internal::task_promise_result< T >
+      {
+      private:
+         friend class task;
+
+         std::coroutine_handle<> m_continuation;
+         std::exception_ptr m_exception;
+
+         struct final_awaiter
+         {
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+               return false;
+            }
+
+            [[nodiscard]] auto await_suspend( const std::coroutine_handle< promise_type > handle ) const noexcept -> std::coroutine_handle<>
+            {
+               if( const auto continuation = handle.promise().m_continuation ) {
+                  return continuation;
+               }
+               return std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept {}
+         };
+
+      public:
+         [[nodiscard]] auto get_return_object() noexcept -> task
+         {
+            return task( std::coroutine_handle< promise_type >::from_promise( *this ) );
+         }
+
+         [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always
+         {
+            return {};
+         }
+
+         [[nodiscard]] auto final_suspend() const noexcept -> final_awaiter
+         {
+            return {};
+         }
+
+         void unhandled_exception() noexcept
+         {
+            m_exception = std::current_exception();
+         }
+
+         [[nodiscard]] auto result() -> T
+         {
+            if( m_exception ) {
+               std::rethrow_exception( m_exception );
+            }
+            return this->value();
+         }
+      };
+
+   private:
+      friend class event_loop;
+
+      std::coroutine_handle< promise_type > m_handle;
+
+      explicit task( const std::coroutine_handle< promise_type > handle ) noexcept
+         : m_handle( handle )
+      {}
+
+   public:
+      task( const task& ) = delete;
+      void operator=( const task& ) = delete;
+
+      task( task&& other ) noexcept
+         : m_handle( std::exchange( other.m_handle, nullptr ) )
+      {}
+
+      auto operator=( task&& other ) noexcept -> task&
+      {
+         if( this != &other ) {
+            if( m_handle ) {
+               m_handle.destroy();
+            }
+            m_handle = std::exchange( other.m_handle, nullptr );
+         }
+         return *this;
+      }
+
+      ~task()
+      {
+         if( m_handle ) {
+            m_handle.destroy();
+         }
+      }
+
+      [[nodiscard]] auto done() const noexcept -> bool
+      {
+         return m_handle && m_handle.done();
+      }
+
+      [[nodiscard]] auto operator co_await() && noexcept
+      {
+         struct awaiter
+         {
+            std::coroutine_handle< promise_type > m_handle;
+
+            [[nodiscard]] auto await_ready() const noexcept -> bool
+            {
+               return false;
+            }
+
+            [[nodiscard]] auto await_suspend( const std::coroutine_handle<> continuation ) const noexcept -> std::coroutine_handle<>
+            {
+               m_handle.promise().m_continuation = continuation;
+               return m_handle;
+            }
+
+            auto await_resume() const -> T
+            {
+               return m_handle.promise().result();
+            }
+         };
+         return awaiter{ m_handle };
+      }
+   };
+
+   inline void event_loop::wait_for_sockets()
+   {
+      std::vector< internal::pollfd > fds;
+      fds.reserve( m_waiting.size() );
+      for( const auto* operation : m_waiting ) {
+         internal::pollfd fd = {};
+         fd.fd = operation->socket();
+         fd.events = operation->wants_write() ? ( POLLIN | POLLOUT ) : POLLIN;
+         fds.push_back( fd );
+      }
+      if( internal::poll( fds.data(), fds.size() ) <= 0 ) {
+         return;  // LCOV_EXCL_LINE
+      }
+      std::vector< internal::awaitable_operation* > waiting;
+      waiting.reserve( m_waiting.size() );
+      for( std::size_t i = 0; i < fds.size(); ++i ) {
+         auto* operation = m_waiting[ i ];
+         if( ( fds[ i ].revents != 0 ) && operation->poll() ) {
+            schedule( operation->handle() );
+         }
+         else {
+            waiting.push_back( operation );
+         }
+      }
+      m_waiting.swap( waiting );
+   }
+
+   inline void event_loop::reap_spawned()
+   {
+      for( auto it = m_spawned.begin(); it != m_spawned.end(); ) {
+         if( it->done() ) {
+            const task<> t = std::move( *it );
+            it = m_spawned.erase( it );
+            t.m_handle.promise().result();
+         }
+         else {
+            ++it;
+         }
+      }
+   }
+
+   inline void event_loop::spawn( task<>&& t )
+   {
+      schedule( t.m_handle );
+      m_spawned.push_back( std::move( t ) );
+   }
+
+   inline void event_loop::run()
+   {
+      event_loop*& current = current_ptr();
+      if( current != nullptr ) {
+         throw std::logic_error( "tao::pq::event_loop is already running" );
+      }
+      current = this;
+      // when an exception escapes, the remaining tasks are abandoned, their frames must not be resumed or polled
+      struct reset_current
+      {
+         event_loop& m_loop;
+         event_loop*& m_current;
+
+         ~reset_current()
+         {
+            m_loop.m_ready.clear();
+            m_loop.m_waiting.clear();
+            m_current = nullptr;
+         }
+      } const reset{ *this, current };
+
+      while( !m_ready.empty() || !m_waiting.empty() ) {
+         while( !m_ready.empty() ) {
+            const auto handle = m_ready.front();
+            m_ready.pop_front();
+            handle.resume();
+            reap_spawned();
+         }
+         if( !m_waiting.empty() ) {
+            wait_for_sockets();
+         }
+      }
+   }
+
+   template< typename T >
+   auto event_loop::run( task< T >&& t ) -> T
+   {
+      const task< T > local = std::move( t );
+      schedule( local.m_handle );
+      run();
+      return local.m_handle.promise().result();
+   }
+
+   namespace internal
+   {
+      class async_connection_awaiter final
+         : public awaitable_operation
+      {
+      private:
+         async_connection m_async;
+
+      public:
+         explicit async_connection_awaiter( async_connection&& connection )
+            : awaitable_operation( nullptr ),
+              m_async( std::move( connection ) )
+         {}
+
+         [[nodiscard]] auto poll() -> bool override
+         {
+            return m_async.ready();
+         }
+
+         [[nodiscard]] auto socket() const -> int override
+         {
+            return m_async.socket();
+         }
+
+         [[nodiscard]] auto wants_write() const -> bool override
+         {
+            return m_async.wants_write();
+         }
+
+         [[nodiscard]] auto await_resume() -> std::shared_ptr< pq::connection >
+         {
+            return m_async.get();
+         }
+      };
+
+      class async_result_awaiter final
+         : public awaitable_operation
+      {
+      private:
+         async_result m_result;
+
+      public:
+         explicit async_result_awaiter( async_result&& result )
+            : awaitable_operation( result.connection() ),
+              m_result( std::move( result ) )
+         {}
+
+         [[nodiscard]] auto poll() -> bool override
+         {
+            return m_result.ready();
+         }
+
+         [[nodiscard]] auto await_resume() -> pq::result
+         {
+            return m_result.get();
+         }
+      };
+
+      class table_reader_awaiter final
+         : public awaitable_operation
+      {
+      private:
+         table_reader& m_reader;
+         std::optional< bool > m_row;
+
+      public:
+         explicit table_reader_awaiter( table_reader& reader )
+            : awaitable_operation( reader.connection() ),
+              m_reader( reader )
+         {}
+
+         [[nodiscard]] auto poll() -> bool override
+         {
+            m_row = m_reader.try_get_row();
+            return m_row.has_value();
+         }
+
+         [[nodiscard]] auto await_resume() const -> bool
+         {
+            return *m_row;
+         }
+      };
+
+      class table_writer_awaiter final
+         : public awaitable_operation
+      {
+      private:
+         table_writer& m_writer;
+         std::optional< std::size_t > m_rows_affected;
+
+      public:
+         explicit table_writer_awaiter( table_writer& writer )
+            : awaitable_operation( writer.connection() ),
+              m_writer( writer )
+         {}
+
+         [[nodiscard]] auto poll() -> bool override
+         {
+            m_rows_affected = m_writer.try_commit();
+            return m_rows_affected.has_value();
+         }
+
+         [[nodiscard]] auto await_resume() const -> std::size_t
+         {
+            return *m_rows_affected;
+         }
+      };
+
+   }  // namespace internal
+
+   // co_await connection::create_async( ... ) -> std::shared_ptr< connection >
+   [[nodiscard]] inline auto operator co_await( async_connection&& connection )
+   {
+      return internal::async_connection_awaiter( std::move( connection ) );
+   }
+
+   // co_await transaction->async_execute( ... ) -> result
+   [[nodiscard]] inline auto operator co_await( async_result&& result )
+   {
+      return internal::async_result_awaiter( std::move( result ) );
+   }
+
+   // co_await async_get_row( reader ) -> bool, see table_reader::get_row()
+   [[nodiscard]] inline auto async_get_row( table_reader& reader )
+   {
+      return internal::table_reader_awaiter( reader );
+   }
+
+   // co_await async_commit( writer ) -> std::size_t, see table_writer::commit()
+   [[nodiscard]] inline auto async_commit( table_writer& writer )
+   {
+      return internal::table_writer_awaiter( writer );
+   }
+
+}  // namespace tao::pq
+
+#endif
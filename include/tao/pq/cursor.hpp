@@ -0,0 +1,250 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_CURSOR_HPP
+#define TAO_PQ_CURSOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/internal/printf.hpp>
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/row.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   class cursor final
+   {
+   protected:
+      std::shared_ptr< transaction > m_transaction;
+      const std::size_t m_fetch_size;
+      const std::string m_name;
+      const std::string m_fetch;
+      std::optional< result > m_result;
+      std::size_t m_row = 0;
+      std::optional< async_result > m_prefetch;
+
+      void receive( const result& batch );
+
+   public:
+      template< typename... As >
+      cursor( const std::shared_ptr< transaction >& transaction, const std::size_t fetch_size, const internal::zsv statement, As&&... as )
+         : m_transaction( transaction->subtransaction() ),
+           m_fetch_size( fetch_size ),
+           m_name( internal::printf( "\"TAOPQ_%p\"", static_cast< const void* >( this ) ) ),
+           m_fetch( internal::printf( "FETCH %zu FROM %s", fetch_size, m_name.c_str() ) )
+      {
+         if( m_fetch_size == 0 ) {
+            throw std::invalid_argument( "fetch size must not be zero" );
+         }
+         m_transaction->execute( "DECLARE " + m_name + " NO SCROLL CURSOR FOR " + static_cast< const char* >( statement ), std::forward< As >( as )... );
+         receive( m_transaction->execute( m_fetch ) );
+      }
+
+      ~cursor() = default;
+
+      cursor( const cursor& ) = delete;
+      cursor( cursor&& ) = delete;
+      void operator=( const cursor& ) = delete;
+      void operator=( cursor&& ) = delete;
+
+      [[nodiscard]] auto fetch_size() const noexcept -> std::size_t
+      {
+         return m_fetch_size;
+      }
+
+      [[nodiscard]] auto columns() const noexcept -> std::size_t
+      {
+         return m_result->columns();
+      }
+
+      [[nodiscard]] auto has_row() const noexcept -> bool
+      {
+         return m_row < m_result->size();
+      }
+
+      // the row is valid until the next batch is fetched
+      [[nodiscard]] auto row() const noexcept -> pq::row
+      {
+         return ( *m_result )[ m_row ];
+      }
+
+      auto next() -> bool;
+
+   private:
+      class const_iterator
+         : private pq::row
+      {
+      private:
+         friend class cursor;
+
+         cursor* m_cursor;
+
+         explicit const_iterator( cursor* c ) noexcept
+            : m_cursor( c )
+         {
+            if( m_cursor != nullptr ) {
+               if( m_cursor->has_row() ) {
+                  static_cast< pq::row& >( *this ) = m_cursor->row();
+               }
+               else {
+                  m_cursor = nullptr;
+               }
+            }
+         }
+
+      public:
+         using difference_type = std::int32_t;
+         using value_type = const pq::row;
+         using pointer = const pq::row*;
+         using reference = const pq::row&;
+         using iterator_category = std::input_iterator_tag;
+
+         auto operator++() -> const_iterator&
+         {
+            if( m_cursor->next() ) {
+               static_cast< pq::row& >( *this ) = m_cursor->row();
+            }
+            else {
+               m_cursor = nullptr;
+            }
+            return *this;
+         }
+
+         auto operator++( int ) -> const_iterator
+         {
+            return ++const_iterator( *this );
+         }
+
+         [[nodiscard]] auto operator*() const noexcept -> const pq::row&
+         {
+            return *this;
+         }
+
+         [[nodiscard]] auto operator->() const noexcept -> const pq::row*
+         {
+            return this;
+         }
+
+         [[nodiscard]] friend auto operator==( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_cursor == rhs.m_cursor;
+         }
+
+         [[nodiscard]] friend auto operator!=( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_cursor != rhs.m_cursor;
+         }
+      };
+
+   public:
+      [[nodiscard]] auto begin() noexcept -> const_iterator
+      {
+         return const_iterator( this );
+      }
+
+      [[nodiscard]] auto end() noexcept -> const_iterator
+      {
+         return const_iterator( nullptr );
+      }
+
+      [[nodiscard]] auto cbegin() noexcept
+      {
+         return begin();
+      }
+
+      [[nodiscard]] auto cend() noexcept
+      {
+         return end();
+      }
+
+      template< typename T >
+      [[nodiscard]] auto as_container() -> T
+      {
+         T nrv;
+         for( const auto& row : *this ) {
+            nrv.insert( nrv.end(), row.as< typename T::value_type >() );
+         }
+         return nrv;
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto vector()
+      {
+         return as_container< std::vector< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto list()
+      {
+         return as_container< std::list< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto set()
+      {
+         return as_container< std::set< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto multiset()
+      {
+         return as_container< std::multiset< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto unordered_set()
+      {
+         return as_container< std::unordered_set< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto unordered_multiset()
+      {
+         return as_container< std::unordered_multiset< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto map()
+      {
+         return as_container< std::map< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto multimap()
+      {
+         return as_container< std::multimap< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto unordered_map()
+      {
+         return as_container< std::unordered_map< Ts... > >();
+      }
+
+      template< typename... Ts >
+      [[nodiscard]] auto unordered_multimap()
+      {
+         return as_container< std::unordered_multimap< Ts... > >();
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
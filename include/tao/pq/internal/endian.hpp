@@ -0,0 +1,75 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_ENDIAN_HPP
+#define TAO_PQ_INTERNAL_ENDIAN_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined( _WIN32 ) && !defined( __MINGW32__ ) && !defined( __CYGWIN__ )
+#include <tao/pq/internal/endian_win.hpp>
+#else
+#include <tao/pq/internal/endian_gcc.hpp>
+#endif
+
+namespace tao::pq::internal
+{
+   template< std::size_t S >
+   struct uint_of_size;
+
+   template<>
+   struct uint_of_size< 1 >
+   {
+      using type = std::uint8_t;
+   };
+
+   template<>
+   struct uint_of_size< 2 >
+   {
+      using type = std::uint16_t;
+   };
+
+   template<>
+   struct uint_of_size< 4 >
+   {
+      using type = std::uint32_t;
+   };
+
+   template<>
+   struct uint_of_size< 8 >
+   {
+      using type = std::uint64_t;
+   };
+
+   // writes the value in network byte order, i.e. big-endian
+   template< typename T >
+   void store_be( char* dst, const T v ) noexcept
+   {
+      static_assert( std::is_arithmetic_v< T > );
+      using U = typename uint_of_size< sizeof( T ) >::type;
+      U u;
+      std::memcpy( &u, &v, sizeof( T ) );
+      u = h_to_be( u );
+      std::memcpy( dst, &u, sizeof( T ) );
+   }
+
+   // reads a value in network byte order, i.e. big-endian
+   template< typename T >
+   [[nodiscard]] auto load_be( const char* src ) noexcept -> T
+   {
+      static_assert( std::is_arithmetic_v< T > );
+      using U = typename uint_of_size< sizeof( T ) >::type;
+      U u;
+      std::memcpy( &u, src, sizeof( T ) );
+      u = be_to_h( u );
+      T v;
+      std::memcpy( &v, &u, sizeof( T ) );
+      return v;
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,72 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_ENDIAN_GCC_HPP
+#define TAO_PQ_INTERNAL_ENDIAN_GCC_HPP
+
+#include <cstdint>
+
+#if !defined( __BYTE_ORDER__ ) || !defined( __ORDER_BIG_ENDIAN__ ) || !defined( __ORDER_LITTLE_ENDIAN__ )
+#error "unable to determine byte order"
+#endif
+
+namespace tao::pq::internal
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint8_t v ) noexcept -> std::uint8_t
+   {
+      return v;
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint16_t v ) noexcept -> std::uint16_t
+   {
+      return v;
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint32_t v ) noexcept -> std::uint32_t
+   {
+      return v;
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint64_t v ) noexcept -> std::uint64_t
+   {
+      return v;
+   }
+
+#elif __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint8_t v ) noexcept -> std::uint8_t
+   {
+      return v;
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint16_t v ) noexcept -> std::uint16_t
+   {
+      return __builtin_bswap16( v );
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint32_t v ) noexcept -> std::uint32_t
+   {
+      return __builtin_bswap32( v );
+   }
+
+   [[nodiscard]] constexpr auto h_to_be( const std::uint64_t v ) noexcept -> std::uint64_t
+   {
+      return __builtin_bswap64( v );
+   }
+
+#else
+#error "unsupported byte order"
+#endif
+
+   template< typename T >
+   [[nodiscard]] constexpr auto be_to_h( const T v ) noexcept -> T
+   {
+      return h_to_be( v );
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
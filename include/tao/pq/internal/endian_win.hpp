@@ -0,0 +1,43 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_ENDIAN_WIN_HPP
+#define TAO_PQ_INTERNAL_ENDIAN_WIN_HPP
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace tao::pq::internal
+{
+   // Windows only supports little-endian platforms
+
+   [[nodiscard]] inline auto h_to_be( const std::uint8_t v ) noexcept -> std::uint8_t
+   {
+      return v;
+   }
+
+   [[nodiscard]] inline auto h_to_be( const std::uint16_t v ) noexcept -> std::uint16_t
+   {
+      return _byteswap_ushort( v );
+   }
+
+   [[nodiscard]] inline auto h_to_be( const std::uint32_t v ) noexcept -> std::uint32_t
+   {
+      return _byteswap_ulong( v );
+   }
+
+   [[nodiscard]] inline auto h_to_be( const std::uint64_t v ) noexcept -> std::uint64_t
+   {
+      return _byteswap_uint64( v );
+   }
+
+   template< typename T >
+   [[nodiscard]] auto be_to_h( const T v ) noexcept -> T
+   {
+      return h_to_be( v );
+   }
+
+}  // namespace tao::pq::internal
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_HASH_RING_HPP
+#define TAO_PQ_INTERNAL_HASH_RING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tao::pq::internal
+{
+   // FNV-1a, stable across platforms and processes (unlike std::hash)
+   [[nodiscard]] constexpr auto fnv1a( const std::string_view sv ) noexcept -> std::uint64_t
+   {
+      std::uint64_t h = 0xcbf29ce484222325;
+      for( const char c : sv ) {
+         h ^= static_cast< unsigned char >( c );
+         h *= 0x100000001b3;
+      }
+      return h;
+   }
+
+   // the finalizer of splitmix64, spreads similar inputs over the whole range
+   [[nodiscard]] constexpr auto mix( std::uint64_t h ) noexcept -> std::uint64_t
+   {
+      h ^= h >> 30;
+      h *= 0xbf58476d1ce4e5b9;
+      h ^= h >> 27;
+      h *= 0x94d049bb133111eb;
+      h ^= h >> 31;
+      return h;
+   }
+
+   // consistent hashing: adding a node only moves keys to the new node
+   class hash_ring final
+   {
+   private:
+      std::size_t m_nodes;
+      std::vector< std::pair< std::uint64_t, std::size_t > > m_points;
+
+   public:
+      explicit hash_ring( const std::size_t nodes, const std::size_t points_per_node = 160 )
+         : m_nodes( nodes )
+      {
+         if( ( nodes == 0 ) || ( points_per_node == 0 ) ) {
+            throw std::invalid_argument( "hash ring requires at least one node and one point per node" );
+         }
+         m_points.reserve( nodes * points_per_node );
+         for( std::size_t node = 0; node < nodes; ++node ) {
+            for( std::size_t point = 0; point < points_per_node; ++point ) {
+               m_points.emplace_back( internal::mix( ( static_cast< std::uint64_t >( node ) << 32 ) | point ), node );
+            }
+         }
+         std::sort( m_points.begin(), m_points.end() );
+      }
+
+      [[nodiscard]] auto nodes() const noexcept -> std::size_t
+      {
+         return m_nodes;
+      }
+
+      [[nodiscard]] auto operator()( const std::string_view key ) const noexcept -> std::size_t
+      {
+         const std::uint64_t h = internal::mix( internal::fnv1a( key ) );
+         const auto it = std::lower_bound( m_points.begin(), m_points.end(), h, []( const auto& point, const std::uint64_t value ) { return point.first < value; } );
+         return ( it == m_points.end() ) ? m_points.front().second : it->second;
+      }
+   };
+
+}  // namespace tao::pq::internal
+
+#endif
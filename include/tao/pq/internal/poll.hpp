@@ -0,0 +1,48 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_INTERNAL_POLL_HPP
+#define TAO_PQ_INTERNAL_POLL_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <system_error>
+
+#if defined( _WIN32 )
+#include <winsock2.h>
+#else
+#include <poll.h>
+#endif
+
+namespace tao::pq::internal
+{
+#if defined( _WIN32 )
+   using pollfd = ::WSAPOLLFD;
+
+   // waits for events on the sockets, a negative timeout waits indefinitely
+   [[nodiscard]] inline auto poll( pollfd* fds, const std::size_t nfds, const int timeout_ms = -1 ) -> int
+   {
+      const int r = ::WSAPoll( fds, static_cast< ULONG >( nfds ), timeout_ms );
+      if( r == SOCKET_ERROR ) {
+         throw std::system_error( ::WSAGetLastError(), std::system_category(), "WSAPoll() failed" );  // LCOV_EXCL_LINE
+      }
+      return r;
+   }
+#else
+   using pollfd = ::pollfd;
+
+   // waits for events on the sockets, a negative timeout waits indefinitely
+   [[nodiscard]] inline auto poll( pollfd* fds, const std::size_t nfds, const int timeout_ms = -1 ) -> int
+   {
+      const int r = ::poll( fds, static_cast< ::nfds_t >( nfds ), timeout_ms );
+      if( ( r < 0 ) && ( errno != EINTR ) ) {
+         throw std::system_error( errno, std::system_category(), "poll() failed" );  // LCOV_EXCL_LINE
+      }
+      return r;
+   }
+#endif
+
+}  // namespace tao::pq::internal
+
+#endif
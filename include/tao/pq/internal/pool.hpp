@@ -5,70 +5,616 @@
 #ifndef TAO_PQ_INTERNAL_POOL_HPP
 #define TAO_PQ_INTERNAL_POOL_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
-#include <list>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
 #include <utility>
+#include <vector>
+
+#include <tao/pq/pool_statistics.hpp>
 
 namespace tao::pq::internal
 {
+   // a small number per thread, used to spread threads over the shards of a pool
+   [[nodiscard]] inline auto thread_hash() noexcept -> std::size_t
+   {
+      thread_local const std::size_t hash = std::hash< std::thread::id >()( std::this_thread::get_id() );
+      return hash;
+   }
+
    template< typename T >
    class pool
       : public std::enable_shared_from_this< pool< T > >
    {
+   public:
+      using clock = std::chrono::steady_clock;
+
    private:
-      std::list< std::shared_ptr< T > > m_items;
-      std::mutex m_mutex;
+      struct idle_item
+      {
+         std::shared_ptr< T > item;
+         clock::time_point since;
+      };
+
+      // idle items are kept in several shards to reduce contention, each thread
+      // prefers its own shard and only steals from other shards when it is empty
+      struct alignas( 64 ) shard
+      {
+         std::mutex mutex;
+         std::vector< idle_item > items;
+      };
+
+      const std::size_t m_shard_count;
+      const std::unique_ptr< shard[] > m_shards;
+      std::atomic< std::size_t > m_idle = 0;
+
+      // the slow path: creating items and waiting for returned items
+      mutable std::mutex m_mutex;
+      std::condition_variable m_condition;
+      std::atomic< std::size_t > m_waiters = 0;
+
+      // number of items belonging to the pool, either idle or borrowed
+      std::size_t m_size = 0;
+      const std::size_t m_max_size;
+      const std::size_t m_min_idle;
+
+      // zero means no limit
+      std::atomic< clock::duration > m_idle_timeout = clock::duration::zero();
+      std::atomic< clock::duration > m_max_lifetime = clock::duration::zero();
+      std::atomic< clock::time_point > m_last_maintenance = clock::time_point::max();
+
+      std::atomic< std::uint64_t > m_created = 0;
+      std::atomic< std::uint64_t > m_reused = 0;
+      std::atomic< std::uint64_t > m_discarded = 0;
+      internal::duration_recorder m_acquire;
+      internal::duration_recorder m_create;
+      internal::duration_recorder m_checkout;
+
+      // optional per-thread caches of idle items, registered with the pool so that
+      // waiting threads can reclaim cached items, see local() and reclaim()
+      struct local_cache
+      {
+         std::mutex mutex;
+         std::vector< std::pair< std::unique_ptr< T >, clock::time_point > > items;
+      };
+
+      struct local_entry
+      {
+         std::uint64_t id;
+         std::weak_ptr< pool > owner;
+         std::shared_ptr< local_cache > cache;
+      };
+
+      struct local_caches
+      {
+         std::vector< local_entry > entries;
+         bool* const destroyed;
+
+         explicit local_caches( bool* d ) noexcept
+            : destroyed( d )
+         {}
+
+         local_caches( const local_caches& ) = delete;
+         local_caches( local_caches&& ) = delete;
+         void operator=( const local_caches& ) = delete;
+         void operator=( local_caches&& ) = delete;
+
+         ~local_caches()
+         {
+            // items released by other thread-local objects from now on bypass the cache
+            *destroyed = true;
+            for( auto& entry : entries ) {
+               if( const auto p = entry.owner.lock() ) {
+                  p->unregister( entry.cache );
+               }
+            }
+         }
+      };
+
+      const std::uint64_t m_id;
+      std::atomic< std::size_t > m_thread_cache = 0;
+      std::atomic< std::size_t > m_cached = 0;
+      std::vector< std::shared_ptr< local_cache > > m_caches;
+
+      std::thread m_maintenance;
+      std::mutex m_maintenance_mutex;
+      std::condition_variable m_maintenance_condition;
+      bool m_maintenance_stop = false;
+      bool m_maintenance_active = false;
+      bool m_maintenance_requested = false;
 
       struct deleter final
       {
          std::weak_ptr< pool > m_pool;
+         clock::time_point m_created;
+         clock::time_point m_borrowed;
 
-         deleter() = default;
+         explicit deleter( const clock::time_point created ) noexcept
+            : m_created( created )
+         {}
 
-         explicit deleter( std::weak_ptr< pool >&& p ) noexcept
-            : m_pool( std::move( p ) )
+         deleter( std::weak_ptr< pool >&& p, const clock::time_point created ) noexcept
+            : m_pool( std::move( p ) ),
+              m_created( created ),
+              m_borrowed( created )
          {}
 
          void operator()( T* item ) const noexcept
          {
             std::unique_ptr< T > up( item );
             if( const auto p = m_pool.lock() ) {
-               p->push( up );
+               p->push( up, m_created, m_borrowed );
             }
          }
       };
 
+      [[nodiscard]] static auto next_id() noexcept -> std::uint64_t
+      {
+         static std::atomic< std::uint64_t > counter = 0;
+         return ++counter;
+      }
+
+      [[nodiscard]] static auto thread_caches() -> local_caches*
+      {
+         thread_local bool destroyed = false;
+         if( destroyed ) {
+            return nullptr;
+         }
+         thread_local local_caches caches( &destroyed );
+         return &caches;
+      }
+
+      // the calling thread's cache for this pool
+      [[nodiscard]] auto local( const bool create ) -> local_cache*
+      {
+         auto* caches = pool::thread_caches();
+         if( caches == nullptr ) {
+            return nullptr;  // LCOV_EXCL_LINE
+         }
+         auto& entries = caches->entries;
+         for( auto it = entries.begin(); it != entries.end(); ) {
+            if( it->id == m_id ) {
+               return it->cache.get();
+            }
+            if( it->owner.expired() ) {
+               it = entries.erase( it );
+            }
+            else {
+               ++it;
+            }
+         }
+         if( !create ) {
+            return nullptr;
+         }
+         auto cache = std::make_shared< local_cache >();
+         {
+            const std::lock_guard lock( m_mutex );
+            m_caches.emplace_back( cache );
+         }
+         entries.push_back( { m_id, this->weak_from_this(), cache } );
+         return cache.get();
+      }
+
+      // called when a thread exits, the cached items are returned to the shared pool
+      void unregister( const std::shared_ptr< local_cache >& cache ) noexcept
+      {
+         {
+            const std::lock_guard lock( m_mutex );
+            m_caches.erase( std::remove( m_caches.begin(), m_caches.end(), cache ), m_caches.end() );
+         }
+         decltype( cache->items ) items;
+         {
+            const std::lock_guard lock( cache->mutex );
+            items.swap( cache->items );
+            m_cached -= items.size();
+         }
+         add_idle( items );
+      }
+
+      // moves all items from the thread caches to the shared pool, called with m_mutex locked
+      [[nodiscard]] auto reclaim() -> std::vector< std::pair< std::unique_ptr< T >, clock::time_point > >
+      {
+         std::vector< std::pair< std::unique_ptr< T >, clock::time_point > > nrv;
+         for( const auto& cache : m_caches ) {
+            const std::lock_guard lock( cache->mutex );
+            m_cached -= cache->items.size();
+            std::move( cache->items.begin(), cache->items.end(), std::back_inserter( nrv ) );
+            cache->items.clear();
+         }
+         return nrv;
+      }
+
+      [[nodiscard]] auto take_local() -> std::shared_ptr< T >
+      {
+         if( m_cached.load( std::memory_order_relaxed ) == 0 ) {
+            return nullptr;
+         }
+         local_cache* cache = local( false );
+         if( cache == nullptr ) {
+            return nullptr;
+         }
+         while( true ) {
+            std::pair< std::unique_ptr< T >, clock::time_point > entry;
+            {
+               const std::lock_guard lock( cache->mutex );
+               if( cache->items.empty() ) {
+                  return nullptr;
+               }
+               entry = std::move( cache->items.back() );
+               cache->items.pop_back();
+               --m_cached;
+            }
+            const auto now = clock::now();
+            if( this->v_is_valid( *entry.first ) && !is_expired( entry.second, now ) ) {
+               deleter d( this->weak_from_this(), entry.second );
+               d.m_borrowed = now;
+               m_reused.fetch_add( 1, std::memory_order_relaxed );
+               return { entry.first.release(), std::move( d ) };
+            }
+            entry.first.reset();
+            discard();
+         }
+      }
+
+      // returns true when the item was put into the calling thread's cache
+      [[nodiscard]] auto put_local( std::unique_ptr< T >& up, const clock::time_point created ) -> bool
+      {
+         const std::size_t capacity = m_thread_cache.load( std::memory_order_relaxed );
+         if( ( capacity == 0 ) || ( m_waiters.load() != 0 ) ) {
+            return false;
+         }
+         local_cache* cache = local( true );
+         if( cache == nullptr ) {
+            return false;  // LCOV_EXCL_LINE
+         }
+         {
+            const std::lock_guard lock( cache->mutex );
+            if( cache->items.size() >= capacity ) {
+               return false;
+            }
+            cache->items.emplace_back( std::move( up ), created );
+            ++m_cached;
+         }
+         // a thread might have started waiting after the check above, it
+         // reclaims the cached item when woken, see acquire()
+         wake();
+         return true;
+      }
+
+      [[nodiscard]] static auto shard_count() noexcept -> std::size_t
+      {
+         return std::clamp< std::size_t >( std::thread::hardware_concurrency(), 1, 64 );
+      }
+
+      [[nodiscard]] auto home() const noexcept -> std::size_t
+      {
+         return internal::thread_hash() % m_shard_count;
+      }
+
+      [[nodiscard]] static auto created( const std::shared_ptr< T >& sp ) noexcept -> clock::time_point
+      {
+         return std::get_deleter< deleter >( sp )->m_created;
+      }
+
+      [[nodiscard]] auto is_expired( const clock::time_point created, const clock::time_point now ) const noexcept -> bool
+      {
+         const auto max_lifetime = m_max_lifetime.load();
+         return ( max_lifetime != clock::duration::zero() ) && ( now - created >= max_lifetime );
+      }
+
+      void wake() noexcept
+      {
+         // pairs with the waiter incrementing m_waiters before checking m_idle
+         if( m_waiters.load() != 0 ) {
+            {
+               const std::lock_guard lock( m_mutex );
+            }
+            m_condition.notify_all();
+         }
+      }
+
+      void push_idle( idle_item&& entry, const std::size_t index )
+      {
+         shard& s = m_shards[ index ];
+         {
+            const std::lock_guard lock( s.mutex );
+            s.items.emplace_back( std::move( entry ) );
+         }
+         ++m_idle;
+         wake();
+      }
+
+      [[nodiscard]] auto pull() noexcept -> std::shared_ptr< T >
+      {
+         if( m_idle.load( std::memory_order_relaxed ) == 0 ) {
+            return nullptr;
+         }
+         const std::size_t h = home();
+         for( std::size_t i = 0; i < m_shard_count; ++i ) {
+            shard& s = m_shards[ ( h + i ) % m_shard_count ];
+            const std::lock_guard lock( s.mutex );
+            if( !s.items.empty() ) {
+               auto nrv = std::move( s.items.back().item );
+               s.items.pop_back();
+               --m_idle;
+               return nrv;
+            }
+         }
+         return nullptr;
+      }
+
+      void release( const std::size_t n = 1 ) noexcept
+      {
+         {
+            const std::lock_guard lock( m_mutex );
+            m_size -= n;
+         }
+         m_condition.notify_all();
+      }
+
+      void discard( const std::size_t n = 1 ) noexcept
+      {
+         m_discarded.fetch_add( n, std::memory_order_relaxed );
+         release( n );
+      }
+
+      // returns a valid idle item or nullptr, discards invalid and expired items
+      [[nodiscard]] auto take_idle() -> std::shared_ptr< T >
+      {
+         while( auto sp = pull() ) {
+            const auto now = clock::now();
+            if( this->v_is_valid( *sp ) && !is_expired( pool::created( sp ), now ) ) {
+               deleter* d = std::get_deleter< deleter >( sp );
+               d->m_pool = this->weak_from_this();
+               d->m_borrowed = now;
+               m_reused.fetch_add( 1, std::memory_order_relaxed );
+               return sp;
+            }
+            discard();
+         }
+         return nullptr;
+      }
+
+      // asks the maintenance thread to run maintain() now, returns false when it is not running
+      [[nodiscard]] auto request_maintenance() noexcept -> bool
+      {
+         {
+            const std::lock_guard lock( m_maintenance_mutex );
+            if( !m_maintenance_active ) {
+               return false;
+            }
+            m_maintenance_requested = true;
+         }
+         m_maintenance_condition.notify_all();
+         return true;
+      }
+
+      // restores the minimum number of idle items after the caller received its own item,
+      // failures do not affect the caller, the next call of maintain() tries again
+      void top_up() noexcept
+      {
+         if( ( m_min_idle == 0 ) || ( m_idle.load() >= m_min_idle ) || request_maintenance() ) {
+            return;
+         }
+         try {
+            fill();
+         }
+         // LCOV_EXCL_START
+         catch( ... ) {
+         }
+         // LCOV_EXCL_STOP
+      }
+
+      // called after the items were accounted for in m_size
+      [[nodiscard]] auto create_many( const std::size_t n ) -> std::vector< std::unique_ptr< T > >
+      {
+         try {
+            const auto start = clock::now();
+            auto nrv = v_create_many( n );
+            m_create.record( clock::now() - start );
+            m_created.fetch_add( n, std::memory_order_relaxed );
+            return nrv;
+         }
+         catch( ... ) {
+            release( n );
+            throw;
+         }
+      }
+
+      void add_idle( std::vector< std::pair< std::unique_ptr< T >, clock::time_point > >& items )
+      {
+         const auto now = clock::now();
+         std::size_t index = home();
+         for( auto& [ up, created ] : items ) {
+            push_idle( { std::shared_ptr< T >( up.release(), deleter( created ) ), now }, index++ % m_shard_count );
+         }
+      }
+
+      void add_idle( std::vector< std::unique_ptr< T > >& items )
+      {
+         const auto now = clock::now();
+         std::size_t index = home();
+         for( auto& up : items ) {
+            push_idle( { std::shared_ptr< T >( up.release(), deleter( now ) ), now }, index++ % m_shard_count );
+         }
+      }
+
+      // called after the item was accounted for in m_size
+      [[nodiscard]] auto make() -> std::shared_ptr< T >
+      {
+         try {
+            const auto start = clock::now();
+            auto up = v_create();
+            const auto now = clock::now();
+            m_create.record( now - start );
+            m_created.fetch_add( 1, std::memory_order_relaxed );
+            return { up.release(), deleter( this->weak_from_this(), now ) };
+         }
+         catch( ... ) {
+            release();
+            throw;
+         }
+      }
+
+      [[nodiscard]] auto acquire( const std::optional< clock::time_point > deadline ) -> std::shared_ptr< T >
+      {
+         if( auto sp = take_local() ) {
+            return sp;
+         }
+         if( auto sp = take_idle() ) {
+            return sp;
+         }
+         std::unique_lock lock( m_mutex );
+         ++m_waiters;
+         bool timeout = false;
+         while( true ) {
+            if( m_idle.load() != 0 ) {
+               // another thread returned an item in the meantime
+               --m_waiters;
+               lock.unlock();
+               if( auto sp = take_idle() ) {
+                  return sp;
+               }
+               lock.lock();
+               ++m_waiters;
+               continue;
+            }
+            if( ( m_max_size == 0 ) || ( m_size < m_max_size ) ) {
+               --m_waiters;
+               ++m_size;
+               lock.unlock();
+               // the caller's item does not depend on the items created to refill the pool
+               auto nrv = make();
+               top_up();
+               return nrv;
+            }
+            if( m_cached.load() != 0 ) {
+               // idle items in other threads' caches are moved to the shared pool
+               auto items = reclaim();
+               lock.unlock();
+               add_idle( items );
+               lock.lock();
+               continue;
+            }
+            if( timeout ) {
+               --m_waiters;
+               return nullptr;
+            }
+            if( deadline ) {
+               timeout = ( m_condition.wait_until( lock, *deadline ) == std::cv_status::timeout );
+            }
+            else {
+               m_condition.wait( lock );
+            }
+         }
+      }
+
+      static void maintenance_loop( const std::weak_ptr< pool > weak, pool* self, const clock::duration interval ) noexcept
+      {
+         std::unique_lock lock( self->m_maintenance_mutex );
+         while( true ) {
+            (void)self->m_maintenance_condition.wait_for( lock, interval, [ self ] { return self->m_maintenance_stop || self->m_maintenance_requested; } );
+            if( self->m_maintenance_stop ) {
+               return;
+            }
+            self->m_maintenance_requested = false;
+            lock.unlock();
+            if( const auto p = weak.lock() ) {
+               try {
+                  p->maintain();
+               }
+               // LCOV_EXCL_START
+               catch( ... ) {
+                  // e.g. the database server is not reachable, try again later
+               }
+               // LCOV_EXCL_STOP
+            }
+            // the last reference might have been released above, in which case
+            // the pool was destroyed and this thread was detached
+            if( weak.expired() ) {
+               return;
+            }
+            lock.lock();
+         }
+      }
+
    protected:
-      pool() = default;
-      virtual ~pool() = default;
+      explicit pool( const std::size_t max_size = 0, const std::size_t min_idle = 0 )
+         : m_shard_count( pool::shard_count() ),
+           m_shards( new shard[ m_shard_count ] ),
+           m_max_size( max_size ),
+           m_min_idle( min_idle ),
+           m_id( pool::next_id() )
+      {
+         if( ( max_size != 0 ) && ( min_idle > max_size ) ) {
+            throw std::invalid_argument( "minimum number of idle items exceeds maximum size" );
+         }
+      }
+
+      virtual ~pool()
+      {
+         stop_maintenance();
+         // the caches might outlive the pool, but not the cached items
+         for( const auto& cache : m_caches ) {
+            const std::lock_guard lock( cache->mutex );
+            cache->items.clear();
+         }
+      }
 
       // create a new T
       [[nodiscard]] virtual auto v_create() const -> std::unique_ptr< T > = 0;
       [[nodiscard]] virtual auto v_is_valid( T& ) const noexcept -> bool = 0;
 
-      void push( std::unique_ptr< T >& up ) noexcept
+      // called when an item is returned to the pool, returns false if the item can not be reused
+      [[nodiscard]] virtual auto v_reset( T& /*unused*/ ) const noexcept -> bool
       {
-         if( this->v_is_valid( *up ) ) {
-            std::shared_ptr< T > sp( up.release(), deleter() );
-            const std::lock_guard lock( m_mutex );
-            // potentially throws -> calls abort() due to noexcept!
-            m_items.emplace_back( std::move( sp ) );
-         }
+         return true;
       }
 
-      [[nodiscard]] auto pull() noexcept
+      // a more expensive check for idle items, called by maintain()
+      [[nodiscard]] virtual auto v_probe( T& t ) const noexcept -> bool
       {
-         std::shared_ptr< T > nrv;
-         const std::lock_guard lock( m_mutex );
-         if( !m_items.empty() ) {
-            nrv = std::move( m_items.back() );
-            m_items.pop_back();
+         return v_is_valid( t );
+      }
+
+      // create n new Ts, can be overridden to create them concurrently
+      [[nodiscard]] virtual auto v_create_many( const std::size_t n ) const -> std::vector< std::unique_ptr< T > >
+      {
+         std::vector< std::unique_ptr< T > > nrv;
+         nrv.reserve( n );
+         for( std::size_t i = 0; i < n; ++i ) {
+            nrv.emplace_back( v_create() );
          }
          return nrv;
       }
 
+      void push( std::unique_ptr< T >& up, const clock::time_point created, const clock::time_point borrowed ) noexcept
+      {
+         const auto now = clock::now();
+         m_checkout.record( now - borrowed );
+         if( this->v_is_valid( *up ) && !is_expired( created, now ) && this->v_reset( *up ) ) {
+            if( put_local( up, created ) ) {
+               return;
+            }
+            // potentially throws -> calls abort() due to noexcept!
+            push_idle( { std::shared_ptr< T >( up.release(), deleter( created ) ), now }, home() );
+         }
+         else {
+            discard();
+         }
+      }
+
    public:
       pool( const pool& ) = delete;
       pool( pool&& ) = delete;
@@ -77,8 +623,12 @@ namespace tao::pq::internal
 
       static void attach( const std::shared_ptr< T >& sp, std::weak_ptr< pool >&& p ) noexcept
       {
+         pool::detach( sp );
+         if( const auto np = p.lock() ) {
+            const std::lock_guard lock( np->m_mutex );
+            ++np->m_size;
+         }
          deleter* d = std::get_deleter< deleter >( sp );
-         assert( d );
          d->m_pool = std::move( p );
       }
 
@@ -86,38 +636,243 @@ namespace tao::pq::internal
       {
          deleter* d = std::get_deleter< deleter >( sp );
          assert( d );
+         if( const auto p = d->m_pool.lock() ) {
+            p->release();
+         }
          d->m_pool.reset();
       }
 
-      // create a new T which is put into the pool when no longer used
+      [[nodiscard]] auto max_size() const noexcept -> std::size_t
+      {
+         return m_max_size;
+      }
+
+      [[nodiscard]] auto min_idle() const noexcept -> std::size_t
+      {
+         return m_min_idle;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         const std::lock_guard lock( m_mutex );
+         return m_size;
+      }
+
+      // number of idle items, including those in thread caches
+      [[nodiscard]] auto idle() const noexcept -> std::size_t
+      {
+         return m_idle.load() + m_cached.load();
+      }
+
+      // number of borrowed items
+      [[nodiscard]] auto in_use() const noexcept -> std::size_t
+      {
+         const std::lock_guard lock( m_mutex );
+         const std::size_t n = idle();
+         return ( m_size > n ) ? ( m_size - n ) : 0;
+      }
+
+      [[nodiscard]] auto thread_cache() const noexcept -> std::size_t
+      {
+         return m_thread_cache.load();
+      }
+
+      // the maximum number of idle items kept in a cache for each thread, zero disables the caches
+      void set_thread_cache( const std::size_t capacity ) noexcept
+      {
+         m_thread_cache = capacity;
+      }
+
+      // a snapshot of the pool's counters and histograms, which are updated concurrently
+      [[nodiscard]] auto statistics() const noexcept -> pool_statistics
+      {
+         pool_statistics nrv;
+         nrv.created = m_created.load( std::memory_order_relaxed );
+         nrv.reused = m_reused.load( std::memory_order_relaxed );
+         nrv.discarded = m_discarded.load( std::memory_order_relaxed );
+         nrv.idle = idle();
+         nrv.in_use = in_use();
+         nrv.acquire = m_acquire.snapshot();
+         nrv.create = m_create.snapshot();
+         nrv.checkout = m_checkout.snapshot();
+         return nrv;
+      }
+
+      [[nodiscard]] auto idle_timeout() const noexcept -> clock::duration
+      {
+         return m_idle_timeout.load();
+      }
+
+      [[nodiscard]] auto max_lifetime() const noexcept -> clock::duration
+      {
+         return m_max_lifetime.load();
+      }
+
+      // idle items exceeding the minimum number of idle items are discarded by maintain() after this time
+      void set_idle_timeout( const clock::duration timeout ) noexcept
+      {
+         m_idle_timeout = timeout;
+      }
+
+      // items are discarded after this time, instead of being returned to or taken from the pool
+      void set_max_lifetime( const clock::duration lifetime ) noexcept
+      {
+         m_max_lifetime = lifetime;
+      }
+
+      // create new items until the minimum number of idle items is reached,
+      // only items in the shared pool are counted as other threads can not take cached items
+      void fill()
+      {
+         std::size_t n = 0;
+         {
+            const std::lock_guard lock( m_mutex );
+            const std::size_t current = m_idle.load();
+            if( current >= m_min_idle ) {
+               return;
+            }
+            n = m_min_idle - current;
+            if( m_max_size != 0 ) {
+               n = std::min( n, m_max_size - m_size );
+            }
+            m_size += n;
+         }
+         if( n != 0 ) {
+            auto items = create_many( n );
+            add_idle( items );
+         }
+      }
+
+      // create a new T which is put into the pool when no longer used, ignores the maximum size
       [[nodiscard]] auto create() -> std::shared_ptr< T >
       {
-         return { v_create().release(), pool::deleter( this->weak_from_this() ) };
+         {
+            const std::lock_guard lock( m_mutex );
+            ++m_size;
+         }
+         return make();
       }
 
-      // get an instance from the pool or create a new one if necessary
+      // get an instance from the pool or create a new one if necessary,
+      // waits for an instance to be returned when the maximum size is reached
       [[nodiscard]] auto get() -> std::shared_ptr< T >
       {
-         while( const auto sp = pull() ) {
-            if( this->v_is_valid( *sp ) ) {
-               pool::attach( sp, this->weak_from_this() );
-               return sp;
+         const auto start = clock::now();
+         auto nrv = acquire( std::nullopt );
+         m_acquire.record( clock::now() - start );
+         return nrv;
+      }
+
+      // as above, but returns nullptr when no instance became available before the timeout
+      [[nodiscard]] auto get( const clock::duration timeout ) -> std::shared_ptr< T >
+      {
+         const auto start = clock::now();
+         auto nrv = acquire( start + timeout );
+         m_acquire.record( clock::now() - start );
+         return nrv;
+      }
+
+      void erase_invalid()
+      {
+         std::vector< idle_item > deferred_delete;
+         for( std::size_t i = 0; i < m_shard_count; ++i ) {
+            shard& s = m_shards[ i ];
+            const std::lock_guard lock( s.mutex );
+            const auto it = std::stable_partition( s.items.begin(), s.items.end(), [ this ]( const idle_item& e ) { return this->v_is_valid( *e.item ); } );
+            std::move( it, s.items.end(), std::back_inserter( deferred_delete ) );
+            s.items.erase( it, s.items.end() );
+         }
+         if( !deferred_delete.empty() ) {
+            m_idle -= deferred_delete.size();
+            discard( deferred_delete.size() );
+         }
+      }
+
+      // discards expired items, probes items which were idle since the previous call, and refills the pool,
+      // items in thread caches are moved to the shared pool first, so they are maintained like all other items
+      void maintain()
+      {
+         if( m_cached.load() != 0 ) {
+            std::vector< std::pair< std::unique_ptr< T >, clock::time_point > > items;
+            {
+               const std::lock_guard lock( m_mutex );
+               items = reclaim();
+            }
+            add_idle( items );
+         }
+         const auto now = clock::now();
+         const auto previous = m_last_maintenance.exchange( now );
+         const auto idle_timeout = m_idle_timeout.load();
+         std::vector< idle_item > deferred_delete;
+         std::vector< std::pair< idle_item, std::size_t > > probe;
+         for( std::size_t i = 0; i < m_shard_count; ++i ) {
+            shard& s = m_shards[ i ];
+            const std::lock_guard lock( s.mutex );
+            std::vector< idle_item > keep;
+            for( auto& e : s.items ) {
+               if( is_expired( pool::created( e.item ), now ) ) {
+                  deferred_delete.emplace_back( std::move( e ) );
+                  --m_idle;
+               }
+               else if( ( idle_timeout != clock::duration::zero() ) && ( now - e.since >= idle_timeout ) && ( m_idle.load() > m_min_idle ) ) {
+                  deferred_delete.emplace_back( std::move( e ) );
+                  --m_idle;
+               }
+               else if( e.since <= previous ) {
+                  probe.emplace_back( std::move( e ), i );
+                  --m_idle;
+               }
+               else {
+                  keep.emplace_back( std::move( e ) );
+               }
             }
+            s.items.swap( keep );
          }
-         return create();
+         std::size_t evicted = deferred_delete.size();
+         deferred_delete.clear();
+         // probes might block, so they run without holding any lock
+         for( auto& [ e, i ] : probe ) {
+            if( this->v_probe( *e.item ) ) {
+               push_idle( std::move( e ), i );
+            }
+            else {
+               e.item.reset();
+               ++evicted;
+            }
+         }
+         if( evicted != 0 ) {
+            discard( evicted );
+         }
+         fill();
       }
 
-      void erase_invalid()
+      // runs maintain() periodically in a background thread
+      void start_maintenance( const clock::duration interval )
       {
-         std::list< std::shared_ptr< T > > deferred_delete;
-         const std::lock_guard lock( m_mutex );
-         auto it = m_items.begin();
-         while( it != m_items.end() ) {
-            if( !this->v_is_valid( **it ) ) {
-               deferred_delete.splice( deferred_delete.end(), m_items, it++ );
+         stop_maintenance();
+         {
+            const std::lock_guard lock( m_maintenance_mutex );
+            m_maintenance_stop = false;
+            m_maintenance_active = true;
+            m_maintenance_requested = false;
+         }
+         m_maintenance = std::thread( &pool::maintenance_loop, this->weak_from_this(), this, interval );
+      }
+
+      void stop_maintenance() noexcept
+      {
+         if( m_maintenance.joinable() ) {
+            {
+               const std::lock_guard lock( m_maintenance_mutex );
+               m_maintenance_stop = true;
+               m_maintenance_active = false;
+            }
+            m_maintenance_condition.notify_all();
+            if( m_maintenance.get_id() == std::this_thread::get_id() ) {
+               m_maintenance.detach();
             }
             else {
-               ++it;
+               m_maintenance.join();
             }
          }
       }
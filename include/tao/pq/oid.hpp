@@ -14,8 +14,19 @@ namespace tao::pq
    enum class oid : Oid
    {
       invalid = 0,
+      bool_ = 16,
       bytea = 17,
-      text = 25
+      char_ = 18,
+      name = 19,
+      int8 = 20,
+      int2 = 21,
+      int4 = 23,
+      text = 25,
+      float4 = 700,
+      float8 = 701,
+      unknown = 705,
+      bpchar = 1042,
+      varchar = 1043
    };
 
 }  // namespace tao::pq
@@ -13,6 +13,7 @@
 #include <cstring>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 
 #include <tao/pq/binary.hpp>
@@ -32,11 +33,20 @@ namespace tao::pq
       // helper for table_writer
       void table_writer_append( std::string& buffer, std::string_view data );
 
+      // the shortest representation that round-trips, where std::to_chars() supports floating point,
+      // otherwise (or if the shortest representation does not fit) std::snprintf() with the given format
       template< std::size_t N, typename T >
-      void snprintf( char ( &buffer )[ N ], const char* format, const T v ) noexcept
+      void float_to_chars( char ( &buffer )[ N ], const T v, const char* format ) noexcept
       {
          static_assert( N >= 32 );
          if( std::isfinite( v ) ) {
+#if defined( __cpp_lib_to_chars )
+            const auto [ ptr, ec ] = std::to_chars( buffer, buffer + N - 1, v );
+            if( ec == std::errc() ) {
+               *ptr = '\0';
+               return;
+            }
+#endif
             [[maybe_unused]] const auto result = std::snprintf( buffer, N, format, v );
             assert( result > 0 );
             assert( static_cast< std::size_t >( result ) < N );
@@ -281,7 +291,7 @@ namespace tao::pq
    {
       explicit parameter_traits( const float v ) noexcept
       {
-         internal::snprintf( m_buffer, "%.9g", v );
+         internal::float_to_chars( m_buffer, v, "%.9g" );
       }
    };
 
@@ -291,7 +301,7 @@ namespace tao::pq
    {
       explicit parameter_traits( const double v ) noexcept
       {
-         internal::snprintf( m_buffer, "%.17g", v );
+         internal::float_to_chars( m_buffer, v, "%.17g" );
       }
    };
 
@@ -301,7 +311,7 @@ namespace tao::pq
    {
       explicit parameter_traits( const long double v ) noexcept
       {
-         internal::snprintf( m_buffer, "%.21Lg", v );
+         internal::float_to_chars( m_buffer, v, "%.21Lg" );
       }
    };
 
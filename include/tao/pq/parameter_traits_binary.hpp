@@ -0,0 +1,143 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_PARAMETER_TRAITS_BINARY_HPP
+#define TAO_PQ_PARAMETER_TRAITS_BINARY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+#include <tao/pq/internal/dependent_false.hpp>
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/oid.hpp>
+#include <tao/pq/parameter_traits.hpp>
+
+namespace tao::pq
+{
+   // opt-in wrapper, sends the value in binary format with a matching type
+   template< typename T >
+   struct binary_parameter
+   {
+      static_assert( std::is_arithmetic_v< T > );
+
+      const T value;
+
+      explicit constexpr binary_parameter( const T v ) noexcept
+         : value( v )
+      {}
+   };
+
+   template< typename T >
+   binary_parameter( T ) -> binary_parameter< T >;
+
+   namespace internal
+   {
+      // selects the smallest type able to represent all values of T
+      template< typename T, typename = void >
+      struct binary_type
+      {
+         static_assert( dependent_false< T >, "no binary type for T" );
+      };
+
+      template<>
+      struct binary_type< bool >
+      {
+         using type = bool;
+         static constexpr auto type_oid = oid::bool_;
+      };
+
+      template< typename T >
+      struct binary_type< T, std::enable_if_t< std::is_integral_v< T > && !std::is_same_v< T, bool > && !std::is_same_v< T, char > > >
+      {
+         static constexpr std::size_t required = sizeof( T ) + ( std::is_signed_v< T > ? 0 : 1 );
+         static_assert( required <= 8, "unsigned 64-bit integers can not be sent in binary format" );
+
+         using type = std::conditional_t< ( required <= 2 ), std::int16_t, std::conditional_t< ( required <= 4 ), std::int32_t, std::int64_t > >;
+         static constexpr auto type_oid = ( required <= 2 ) ? oid::int2 : ( ( required <= 4 ) ? oid::int4 : oid::int8 );
+      };
+
+      template<>
+      struct binary_type< float >
+      {
+         using type = float;
+         static constexpr auto type_oid = oid::float4;
+      };
+
+      template<>
+      struct binary_type< double >
+      {
+         using type = double;
+         static constexpr auto type_oid = oid::float8;
+      };
+
+   }  // namespace internal
+
+   template< typename T >
+   struct parameter_traits< binary_parameter< T > >
+   {
+   private:
+      using binary_type = internal::binary_type< T >;
+      using wire_t = typename binary_type::type;
+
+      const T m_value;
+      char m_buffer[ sizeof( wire_t ) ];
+
+   public:
+      explicit parameter_traits( const binary_parameter< T > v ) noexcept
+         : m_value( v.value )
+      {
+         if constexpr( std::is_same_v< wire_t, bool > ) {
+            m_buffer[ 0 ] = m_value ? 1 : 0;
+         }
+         else {
+            internal::store_be( m_buffer, static_cast< wire_t >( m_value ) );
+         }
+      }
+
+      static constexpr std::size_t columns = 1;
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto type() noexcept -> oid
+      {
+         return binary_type::type_oid;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] auto value() const noexcept -> const char*
+      {
+         return m_buffer;
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto length() noexcept -> int
+      {
+         return sizeof( wire_t );
+      }
+
+      template< std::size_t I >
+      [[nodiscard]] static constexpr auto format() noexcept -> int
+      {
+         return 1;
+      }
+
+      // arrays and table_writer use the text format
+
+      template< std::size_t I >
+      void element( std::string& data ) const
+      {
+         parameter_traits< T >( m_value ).template element< I >( data );
+      }
+
+      template< std::size_t I >
+      void copy_to( std::string& data ) const
+      {
+         parameter_traits< T >( m_value ).template copy_to< I >( data );
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,51 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_PIPELINE_HPP
+#define TAO_PQ_PIPELINE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   class pipeline final
+   {
+   private:
+      std::shared_ptr< transaction > m_previous;
+      std::shared_ptr< transaction > m_transaction;
+      std::size_t m_unsynced = 0;
+      std::size_t m_syncs = 0;
+
+   public:
+      explicit pipeline( const std::shared_ptr< transaction >& transaction );
+
+      ~pipeline();
+
+      pipeline( const pipeline& ) = delete;
+      pipeline( pipeline&& ) = delete;
+      void operator=( const pipeline& ) = delete;
+      void operator=( pipeline&& ) = delete;
+
+      template< typename... As >
+      void send( const internal::zsv statement, As&&... as )
+      {
+         m_transaction->send( statement, std::forward< As >( as )... );
+         ++m_unsynced;
+      }
+
+      void sync();
+
+      [[nodiscard]] auto finish() -> std::vector< result >;
+   };
+
+}  // namespace tao::pq
+
+#endif
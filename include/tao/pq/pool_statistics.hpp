@@ -0,0 +1,129 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_POOL_STATISTICS_HPP
+#define TAO_PQ_POOL_STATISTICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace tao::pq
+{
+   struct duration_histogram
+   {
+      using duration = std::chrono::steady_clock::duration;
+
+      // bucket 0 counts durations below 1µs, bucket i counts durations below 2^i µs,
+      // the last bucket also counts all longer durations
+      static constexpr std::size_t buckets = 32;
+
+      std::uint64_t count = 0;
+      duration total = duration::zero();
+      duration max = duration::zero();
+      std::array< std::uint64_t, buckets > counts = {};
+
+      [[nodiscard]] static constexpr auto bucket( const duration d ) noexcept -> std::size_t
+      {
+         auto us = static_cast< std::uint64_t >( std::chrono::duration_cast< std::chrono::microseconds >( d ).count() );
+         std::size_t nrv = 0;
+         while( ( us != 0 ) && ( nrv < buckets - 1 ) ) {
+            us >>= 1;
+            ++nrv;
+         }
+         return nrv;
+      }
+
+      // exclusive upper bound of the durations counted in bucket i
+      [[nodiscard]] static constexpr auto upper_bound( const std::size_t i ) noexcept -> duration
+      {
+         return ( i == buckets - 1 ) ? duration::max() : std::chrono::duration_cast< duration >( std::chrono::microseconds( std::uint64_t( 1 ) << i ) );
+      }
+
+      [[nodiscard]] auto mean() const noexcept -> duration
+      {
+         return ( count == 0 ) ? duration::zero() : total / static_cast< duration::rep >( count );
+      }
+
+      // upper bound of the bucket containing the p-th quantile, with 0 <= p <= 1
+      [[nodiscard]] auto quantile( const double p ) const noexcept -> duration
+      {
+         const auto rank = static_cast< std::uint64_t >( p * static_cast< double >( count ) );
+         std::uint64_t sum = 0;
+         for( std::size_t i = 0; i < buckets; ++i ) {
+            sum += counts[ i ];
+            if( ( sum > rank ) || ( ( sum == count ) && ( sum != 0 ) ) ) {
+               return std::min( upper_bound( i ), max );
+            }
+         }
+         return duration::zero();
+      }
+   };
+
+   struct pool_statistics
+   {
+      // number of items created, borrowed from the pool, and discarded by the pool
+      std::uint64_t created = 0;
+      std::uint64_t reused = 0;
+      std::uint64_t discarded = 0;
+
+      std::size_t idle = 0;
+      std::size_t in_use = 0;
+
+      // time spent waiting for an item, including the time to create new items
+      duration_histogram acquire;
+
+      // time to create new items, one sample per batch of concurrently created items
+      duration_histogram create;
+
+      // time between borrowing an item and returning it to the pool
+      duration_histogram checkout;
+   };
+
+   namespace internal
+   {
+      // lock-free recording of a duration_histogram
+      class duration_recorder final
+      {
+      private:
+         using duration = duration_histogram::duration;
+
+         std::atomic< std::uint64_t > m_count = 0;
+         std::atomic< duration::rep > m_total = 0;
+         std::atomic< duration::rep > m_max = 0;
+         std::array< std::atomic< std::uint64_t >, duration_histogram::buckets > m_counts = {};
+
+      public:
+         void record( const duration d ) noexcept
+         {
+            const auto ticks = d.count();
+            m_count.fetch_add( 1, std::memory_order_relaxed );
+            m_total.fetch_add( ticks, std::memory_order_relaxed );
+            auto max = m_max.load( std::memory_order_relaxed );
+            while( ( ticks > max ) && !m_max.compare_exchange_weak( max, ticks, std::memory_order_relaxed ) ) {
+            }
+            m_counts[ duration_histogram::bucket( d ) ].fetch_add( 1, std::memory_order_relaxed );
+         }
+
+         [[nodiscard]] auto snapshot() const noexcept -> duration_histogram
+         {
+            duration_histogram nrv;
+            nrv.count = m_count.load( std::memory_order_relaxed );
+            nrv.total = duration( m_total.load( std::memory_order_relaxed ) );
+            nrv.max = duration( m_max.load( std::memory_order_relaxed ) );
+            for( std::size_t i = 0; i < duration_histogram::buckets; ++i ) {
+               nrv.counts[ i ] = m_counts[ i ].load( std::memory_order_relaxed );
+            }
+            return nrv;
+         }
+      };
+
+   }  // namespace internal
+
+}  // namespace tao::pq
+
+#endif
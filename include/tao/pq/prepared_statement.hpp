@@ -0,0 +1,185 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_PREPARED_STATEMENT_HPP
+#define TAO_PQ_PREPARED_STATEMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/internal/endian.hpp>
+#include <tao/pq/oid.hpp>
+#include <tao/pq/parameter_traits.hpp>
+
+namespace tao::pq
+{
+   class connection;
+
+   // handle for a prepared statement, the parameter types Ts... are checked at
+   // compile time and the server-described types select binary encodings
+   template< typename... Ts >
+   class prepared_statement final
+   {
+   private:
+      friend class connection;
+
+      std::string m_name;
+      std::vector< Oid > m_types;
+
+      prepared_statement( std::string name, std::vector< Oid > types ) noexcept
+         : m_name( std::move( name ) ),
+           m_types( std::move( types ) )
+      {}
+
+   public:
+      [[nodiscard]] auto name() const noexcept -> const std::string&
+      {
+         return m_name;
+      }
+
+      [[nodiscard]] auto parameters() const noexcept -> std::size_t
+      {
+         return m_types.size();
+      }
+
+      [[nodiscard]] auto types() const noexcept -> const std::vector< Oid >&
+      {
+         return m_types;
+      }
+   };
+
+   namespace internal
+   {
+      template< typename W, typename T >
+      [[nodiscard]] constexpr auto in_range( const T v ) noexcept -> bool
+      {
+         if constexpr( std::is_signed_v< T > ) {
+            return ( v >= std::numeric_limits< W >::min() ) && ( v <= std::numeric_limits< W >::max() );
+         }
+         else {
+            return v <= static_cast< std::make_unsigned_t< W > >( std::numeric_limits< W >::max() );
+         }
+      }
+
+      // uses the text format of parameter_traits< T >
+      template< typename T >
+      struct text_parameter
+         : parameter_traits< T >
+      {
+         text_parameter( const T& v, const Oid* /*unused*/ )
+            : parameter_traits< T >( v )
+         {}
+      };
+
+      // uses the binary format when the described type is able to represent the value
+      template< typename T >
+      class described_parameter
+      {
+      private:
+         std::optional< parameter_traits< T > > m_text;
+         char m_buffer[ 8 ];
+         int m_length = 0;
+
+         template< typename W >
+         void store( const W v ) noexcept
+         {
+            internal::store_be( m_buffer, v );
+            m_length = sizeof( W );
+         }
+
+      public:
+         described_parameter( const T v, const Oid* type )
+         {
+            if constexpr( std::is_same_v< T, bool > ) {
+               if( *type == static_cast< Oid >( oid::bool_ ) ) {
+                  m_buffer[ 0 ] = v ? 1 : 0;
+                  m_length = 1;
+               }
+            }
+            else if constexpr( std::is_integral_v< T > ) {
+               switch( static_cast< oid >( *type ) ) {
+                  case oid::int2:
+                     if( internal::in_range< std::int16_t >( v ) ) {
+                        store( static_cast< std::int16_t >( v ) );
+                     }
+                     break;
+
+                  case oid::int4:
+                     if( internal::in_range< std::int32_t >( v ) ) {
+                        store( static_cast< std::int32_t >( v ) );
+                     }
+                     break;
+
+                  case oid::int8:
+                     if( internal::in_range< std::int64_t >( v ) ) {
+                        store( static_cast< std::int64_t >( v ) );
+                     }
+                     break;
+
+                  default:
+                     break;
+               }
+            }
+            else {
+               if( *type == static_cast< Oid >( oid::float8 ) ) {
+                  store( static_cast< double >( v ) );
+               }
+               else if constexpr( std::is_same_v< T, float > ) {
+                  if( *type == static_cast< Oid >( oid::float4 ) ) {
+                     store( v );
+                  }
+               }
+            }
+            if( m_length == 0 ) {
+               m_text.emplace( v );
+            }
+         }
+
+         static constexpr std::size_t columns = 1;
+
+         template< std::size_t I >
+         [[nodiscard]] auto value() const noexcept -> const char*
+         {
+            return ( m_length != 0 ) ? m_buffer : m_text->template value< I >();
+         }
+
+         template< std::size_t I >
+         [[nodiscard]] auto length() const noexcept -> int
+         {
+            return ( m_length != 0 ) ? m_length : m_text->template length< I >();
+         }
+
+         template< std::size_t I >
+         [[nodiscard]] auto format() const noexcept -> int
+         {
+            return ( m_length != 0 ) ? 1 : m_text->template format< I >();
+         }
+      };
+
+      template< typename T >
+      inline constexpr bool is_described = std::is_same_v< T, float > || std::is_same_v< T, double > || ( std::is_integral_v< T > && !std::is_same_v< T, char > );
+
+      template< typename T >
+      using prepared_parameter = std::conditional_t< is_described< T >, described_parameter< T >, text_parameter< T > >;
+
+      // arguments for described parameters must not be narrowed, e.g. an int for a short parameter
+      template< typename T, typename A, typename = void >
+      inline constexpr bool is_non_narrowing = !is_described< T >;
+
+      template< typename T, typename A >
+      inline constexpr bool is_non_narrowing< T, A, std::void_t< decltype( T{ std::declval< A >() } ) > > = true;
+
+   }  // namespace internal
+
+}  // namespace tao::pq
+
+#endif
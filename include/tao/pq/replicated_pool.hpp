@@ -0,0 +1,98 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_REPLICATED_POOL_HPP
+#define TAO_PQ_REPLICATED_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/access_mode.hpp>
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/isolation_level.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   // a connection pool for a primary server and several read replicas
+   class replicated_pool final
+   {
+   private:
+      const std::shared_ptr< connection_pool > m_primary;
+      const std::vector< std::shared_ptr< connection_pool > > m_replicas;
+      std::atomic< std::size_t > m_next = 0;
+
+      // time of the last failure to connect to each replica, zero if none
+      std::vector< std::atomic< std::chrono::steady_clock::rep > > m_failed;
+      std::atomic< std::chrono::steady_clock::rep > m_backoff = std::chrono::steady_clock::duration( std::chrono::seconds( 10 ) ).count();
+
+      // pass-key idiom
+      class private_key final
+      {
+         private_key() = default;
+         friend class replicated_pool;
+      };
+
+   public:
+      replicated_pool( const private_key /*unused*/, std::shared_ptr< connection_pool > primary, std::vector< std::shared_ptr< connection_pool > > replicas ) noexcept;
+
+      replicated_pool( const replicated_pool& ) = delete;
+      replicated_pool( replicated_pool&& ) = delete;
+      void operator=( const replicated_pool& ) = delete;
+      void operator=( replicated_pool&& ) = delete;
+
+      ~replicated_pool() = default;
+
+      [[nodiscard]] static auto create( const std::string_view primary_connection_info, const std::vector< std::string >& replica_connection_infos, const std::size_t max_size = 0, const std::size_t min_idle = 0 ) -> std::shared_ptr< replicated_pool >;
+
+      [[nodiscard]] auto primary() const noexcept -> const std::shared_ptr< connection_pool >&
+      {
+         return m_primary;
+      }
+
+      [[nodiscard]] auto replicas() const noexcept -> const std::vector< std::shared_ptr< connection_pool > >&
+      {
+         return m_replicas;
+      }
+
+      // a connection to the primary server
+      [[nodiscard]] auto connection() -> std::shared_ptr< pq::connection >;
+
+      // a connection to the replica with the fewest borrowed connections,
+      // falls back to the primary server when there are no replicas
+      [[nodiscard]] auto replica_connection() -> std::shared_ptr< pq::connection >;
+
+      // after a replica failed to connect, it is skipped for this duration, zero disables skipping
+      [[nodiscard]] auto backoff() const noexcept -> std::chrono::steady_clock::duration
+      {
+         return std::chrono::steady_clock::duration( m_backoff.load( std::memory_order_relaxed ) );
+      }
+
+      void set_backoff( const std::chrono::steady_clock::duration backoff ) noexcept
+      {
+         m_backoff.store( backoff.count(), std::memory_order_relaxed );
+      }
+
+      // read-only transactions are started on a replica, all others on the primary server
+      [[nodiscard]] auto transaction( const access_mode am = access_mode::default_access_mode, const isolation_level il = isolation_level::default_isolation_level ) -> std::shared_ptr< pq::transaction >;
+      [[nodiscard]] auto transaction( const isolation_level il, const access_mode am = access_mode::default_access_mode ) -> std::shared_ptr< pq::transaction >;
+
+      template< typename... As >
+      auto execute( const internal::zsv statement, As&&... as )
+      {
+         return connection()->direct()->execute( statement, std::forward< As >( as )... );
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
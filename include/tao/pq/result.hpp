@@ -5,6 +5,7 @@
 #ifndef TAO_PQ_RESULT_HPP
 #define TAO_PQ_RESULT_HPP
 
+#include <cstddef>
 #include <iterator>
 #include <list>
 #include <map>
@@ -13,6 +14,7 @@
 #include <set>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -21,19 +23,28 @@
 
 #include <libpq-fe.h>
 
+#include <tao/pq/column_ref.hpp>
+#include <tao/pq/internal/demangle.hpp>
 #include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/oid.hpp>
+#include <tao/pq/result_traits.hpp>
 #include <tao/pq/row.hpp>
 
 namespace tao::pq
 {
+   class async_result;
    class connection;
+   class pipeline;
+   class row_stream;
    class table_reader;
    class table_writer;
    class transaction;
 
    namespace internal
    {
+      class result_state;  // defined in result.cpp
+
       template< typename T, typename = void >
       inline constexpr bool has_reserve = false;
 
@@ -45,7 +56,11 @@ namespace tao::pq
    class result final
    {
    private:
+      friend class async_result;
       friend class connection;
+      friend class pipeline;
+      friend class row;
+      friend class row_stream;
       friend class table_reader;
       friend class table_writer;
       friend class transaction;
@@ -53,9 +68,14 @@ namespace tao::pq
       const std::shared_ptr< PGresult > m_pgresult;
       const std::size_t m_columns;
       const std::size_t m_rows;
+      internal::result_state* const m_state;  // owned by m_pgresult's control block
 
       void check_has_result_set() const;
       void check_row( const std::size_t row ) const;
+      void check_column( const std::size_t column ) const;
+
+      // expects a name as returned by the server, e.g. from column_ref::name()
+      [[nodiscard]] auto find( const std::string_view in_name ) const -> std::optional< std::size_t >;
 
       enum class mode_t
       {
@@ -64,6 +84,7 @@ namespace tao::pq
          expect_copy_out
       };
 
+      result( const std::shared_ptr< internal::result_state >& state, const mode_t mode );
       result( PGresult* pgresult, const mode_t mode = mode_t::expect_ok );
 
    public:
@@ -77,6 +98,10 @@ namespace tao::pq
 
       [[nodiscard]] auto name( const std::size_t column ) const -> std::string;
       [[nodiscard]] auto index( const internal::zsv in_name ) const -> std::size_t;
+      [[nodiscard]] auto index( const column_ref& in_name ) const -> std::size_t;
+
+      [[nodiscard]] auto type( const std::size_t column ) const -> oid;
+      [[nodiscard]] auto is_binary( const std::size_t column ) const -> bool;
 
       [[nodiscard]] auto empty() const -> bool;
       [[nodiscard]] auto size() const -> std::size_t;
@@ -222,6 +247,7 @@ namespace tao::pq
 
       [[nodiscard]] auto is_null( const std::size_t row, const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t row, const std::size_t column ) const -> const char*;
+      [[nodiscard]] auto length( const std::size_t row, const std::size_t column ) const -> std::size_t;
 
       [[nodiscard]] auto operator[]( const std::size_t row ) const noexcept
       {
@@ -268,12 +294,92 @@ namespace tao::pq
             nrv.reserve( size() );
          }
          check_has_result_set();
-         for( const auto& row : *this ) {
-            nrv.insert( nrv.end(), row.as< typename T::value_type >() );
+         if( m_rows != 0 ) {
+            // all rows share the same columns, validate them once
+            ( *this )[ 0 ].check_as< typename T::value_type >();
+            for( const auto& row : *this ) {
+               nrv.insert( nrv.end(), row.as_unchecked< typename T::value_type >() );
+            }
          }
          return nrv;
       }
 
+      // converts a whole column at once, checks are done once per column instead of once per field
+      template< typename T >
+      [[nodiscard]] auto column( const std::size_t column ) const -> std::vector< T >
+      {
+         static_assert( result_traits_size< T > == 1, "tao::pq::result_traits<T>::size does not yield exactly one column for T, which is required for column access" );
+         check_has_result_set();
+         check_column( column );
+         const PGresult* pgresult = m_pgresult.get();
+         const int c = static_cast< int >( column );
+         const bool is_binary_format = PQfformat( pgresult, c ) == 1;
+         const oid type = static_cast< oid >( PQftype( pgresult, c ) );
+         if constexpr( !result_traits_has_binary< T > ) {
+            if( is_binary_format ) {
+               const auto name = internal::demangle< T >();
+               throw std::runtime_error( internal::printf( "binary format not supported by tao::pq::result_traits<%.*s>", static_cast< int >( name.size() ), name.data() ) );
+            }
+         }
+         std::vector< T > nrv;
+         nrv.reserve( m_rows );
+         for( std::size_t row = 0; row < m_rows; ++row ) {
+            const int r = static_cast< int >( row );
+            if( PQgetisnull( pgresult, r, c ) != 0 ) {
+               if constexpr( result_traits_has_null< T > ) {
+                  nrv.push_back( result_traits< T >::null() );
+                  continue;
+               }
+               else {
+                  throw std::runtime_error( internal::printf( "unexpected NULL value in row %zu column %zu = %s", row, column, name( column ).c_str() ) );
+               }
+            }
+            const char* value = PQgetvalue( pgresult, r, c );
+            if constexpr( result_traits_has_binary< T > ) {
+               if( is_binary_format ) {
+                  nrv.push_back( result_traits< T >::from_binary( value, PQgetlength( pgresult, r, c ), type ) );
+                  continue;
+               }
+            }
+            nrv.push_back( result_traits< T >::from( value ) );
+         }
+         return nrv;
+      }
+
+      template< typename T >
+      [[nodiscard]] auto column( const internal::zsv in_name ) const -> std::vector< T >
+      {
+         return column< T >( index( in_name ) );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto column( const column_ref& in_name ) const -> std::vector< T >
+      {
+         return column< T >( index( in_name ) );
+      }
+
+      // one bit per row, set for NULL values
+      [[nodiscard]] auto null_bitmap( const std::size_t column ) const -> std::vector< bool >;
+
+   private:
+      template< typename... Ts, std::size_t... Is >
+      [[nodiscard]] auto columns_impl( std::index_sequence< Is... > /*unused*/ ) const
+      {
+         return std::tuple< std::vector< Ts >... >( column< Ts >( Is )... );
+      }
+
+   public:
+      // converts all columns, one std::vector< T > for each column
+      template< typename... Ts >
+      [[nodiscard]] auto columns() const -> std::tuple< std::vector< Ts >... >
+      {
+         if( sizeof...( Ts ) != m_columns ) {
+            check_has_result_set();
+            throw std::out_of_range( internal::printf( "columns() requires %zu columns, but result has %zu columns", sizeof...( Ts ), m_columns ) );
+         }
+         return columns_impl< Ts... >( std::index_sequence_for< Ts... >() );
+      }
+
       template< typename... Ts >
       [[nodiscard]] auto vector() const
       {
@@ -0,0 +1,18 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_RESULT_FORMAT_HPP
+#define TAO_PQ_RESULT_FORMAT_HPP
+
+namespace tao::pq
+{
+   enum class result_format
+   {
+      text_format = 0,
+      binary_format = 1
+   };
+
+}  // namespace tao::pq
+
+#endif
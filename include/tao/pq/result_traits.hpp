@@ -15,6 +15,7 @@
 #include <tao/pq/binary.hpp>
 #include <tao/pq/internal/dependent_false.hpp>
 #include <tao/pq/internal/exclusive_scan.hpp>
+#include <tao/pq/oid.hpp>
 
 namespace tao::pq
 {
@@ -24,6 +25,9 @@ namespace tao::pq
       static_assert( internal::dependent_false< T >, "data type T not registered as taopq result type" );
 
       static auto from( const char* value ) noexcept -> T;
+
+      // optional, for results in binary format
+      static auto from_binary( const char* value, const std::size_t size, const oid type ) -> T;
    };
 
    template< typename T, typename = const std::size_t >
@@ -38,6 +42,12 @@ namespace tao::pq
    template< typename T >
    inline constexpr bool result_traits_has_null< T, decltype( (void)result_traits< T >::null() ) > = true;
 
+   template< typename T, typename = void >
+   inline constexpr bool result_traits_has_binary = false;
+
+   template< typename T >
+   inline constexpr bool result_traits_has_binary< T, decltype( (void)result_traits< T >::from_binary( std::declval< const char* >(), std::size_t(), oid() ) ) > = true;
+
    template<>
    struct result_traits< const char* >
    {
@@ -45,6 +55,9 @@ namespace tao::pq
       {
          return value;
       }
+
+      // only for text-like types, the value is zero-terminated in binary format as well
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> const char*;
    };
 
    template<>
@@ -54,96 +67,114 @@ namespace tao::pq
       {
          return value;
       }
+
+      // only for text-like types
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> std::string_view;
    };
 
    template<>
    struct result_traits< bool >
    {
       [[nodiscard]] static auto from( const char* value ) -> bool;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> bool;
    };
 
    template<>
    struct result_traits< char >
    {
       [[nodiscard]] static auto from( const char* value ) -> char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> char;
    };
 
    template<>
    struct result_traits< signed char >
    {
       [[nodiscard]] static auto from( const char* value ) -> signed char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> signed char;
    };
 
    template<>
    struct result_traits< unsigned char >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned char;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned char;
    };
 
    template<>
    struct result_traits< short >
    {
       [[nodiscard]] static auto from( const char* value ) -> short;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> short;
    };
 
    template<>
    struct result_traits< unsigned short >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned short;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned short;
    };
 
    template<>
    struct result_traits< int >
    {
       [[nodiscard]] static auto from( const char* value ) -> int;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> int;
    };
 
    template<>
    struct result_traits< unsigned >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned;
    };
 
    template<>
    struct result_traits< long >
    {
       [[nodiscard]] static auto from( const char* value ) -> long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> long;
    };
 
    template<>
    struct result_traits< unsigned long >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned long;
    };
 
    template<>
    struct result_traits< long long >
    {
       [[nodiscard]] static auto from( const char* value ) -> long long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> long long;
    };
 
    template<>
    struct result_traits< unsigned long long >
    {
       [[nodiscard]] static auto from( const char* value ) -> unsigned long long;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned long long;
    };
 
    template<>
    struct result_traits< float >
    {
       [[nodiscard]] static auto from( const char* value ) -> float;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> float;
    };
 
    template<>
    struct result_traits< double >
    {
       [[nodiscard]] static auto from( const char* value ) -> double;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> double;
    };
 
    template<>
    struct result_traits< long double >
    {
       [[nodiscard]] static auto from( const char* value ) -> long double;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> long double;
    };
 
    template<>
@@ -153,18 +184,23 @@ namespace tao::pq
       {
          return value;
       }
+
+      // only for text-like types
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> std::string;
    };
 
    template<>
    struct result_traits< std::basic_string< unsigned char > >
    {
       [[nodiscard]] static auto from( const char* value ) -> std::basic_string< unsigned char >;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> std::basic_string< unsigned char >;
    };
 
    template<>
    struct result_traits< binary >
    {
       [[nodiscard]] static auto from( const char* value ) -> binary;
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> binary;
    };
 
    namespace internal
@@ -5,7 +5,9 @@
 #ifndef TAO_PQ_RESULT_TRAITS_OPTIONAL_HPP
 #define TAO_PQ_RESULT_TRAITS_OPTIONAL_HPP
 
+#include <cstddef>
 #include <optional>
+#include <type_traits>
 
 #include <tao/pq/result_traits.hpp>
 #include <tao/pq/row.hpp>
@@ -27,6 +29,12 @@ namespace tao::pq
          return result_traits< T >::from( value );
       }
 
+      template< typename U = T, typename = std::enable_if_t< result_traits_has_binary< U > > >
+      [[nodiscard]] static auto from_binary( const char* value, const std::size_t size, const oid type ) -> std::optional< T >
+      {
+         return result_traits< T >::from_binary( value, size, type );
+      }
+
       template< typename Row >
       [[nodiscard]] static auto from( const Row& row ) -> std::optional< T >
       {
@@ -9,16 +9,19 @@
 #include <optional>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include <tao/pq/column_ref.hpp>
 #include <tao/pq/field.hpp>
 #include <tao/pq/internal/demangle.hpp>
 #include <tao/pq/internal/dependent_false.hpp>
 #include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/unreachable.hpp>
 #include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/oid.hpp>
 #include <tao/pq/result_traits.hpp>
 
 namespace tao::pq
@@ -46,6 +49,66 @@ namespace tao::pq
       {}
 
       void ensure_column( const std::size_t column ) const;
+      void ensure_field( const std::size_t column ) const;
+
+      // maps a column index of the result to a column index of the row/slice
+      [[nodiscard]] auto slice_index( const std::size_t column, const std::string_view in_name ) const -> std::size_t;
+
+      [[noreturn]] void throw_unexpected_null( const std::size_t column ) const;
+      [[noreturn]] void throw_binary_not_supported( const std::string_view type ) const;
+
+      // no range checks, the caller has to ensure that the row and the column are valid
+      [[nodiscard]] auto is_binary_unchecked( const std::size_t column ) const noexcept -> bool;
+      [[nodiscard]] auto type_unchecked( const std::size_t column ) const noexcept -> oid;
+      [[nodiscard]] auto length_unchecked( const std::size_t column ) const noexcept -> std::size_t;
+
+      // validates the column count and format once, e.g. for all rows of a result
+      template< typename T >
+      void check_as() const
+      {
+         if( result_traits_size< T > != m_columns ) {
+            const auto type = internal::demangle< T >();
+            throw std::out_of_range( internal::printf( "datatype (%.*s) requires %zu columns, but row/slice has %zu columns", static_cast< int >( type.size() ), type.data(), result_traits_size< T >, m_columns ) );
+         }
+         if constexpr( result_traits_size< T > == 1 ) {
+            if constexpr( !result_traits_has_binary< T > ) {
+               if( is_binary_unchecked( 0 ) ) {
+                  throw_binary_not_supported( internal::demangle< T >() );
+               }
+            }
+         }
+      }
+
+      // no checks at all, the caller has to ensure that the field is valid and that T supports its format
+      template< typename T >
+      [[nodiscard]] auto decode_unchecked( const std::size_t column ) const -> T
+      {
+         if( is_null_unchecked( column ) ) {
+            if constexpr( result_traits_has_null< T > ) {
+               return result_traits< T >::null();
+            }
+            else {
+               throw_unexpected_null( column );
+            }
+         }
+         if constexpr( result_traits_has_binary< T > ) {
+            if( is_binary_unchecked( column ) ) {
+               return result_traits< T >::from_binary( get_unchecked( column ), length_unchecked( column ), type_unchecked( column ) );
+            }
+         }
+         return result_traits< T >::from( get_unchecked( column ) );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto as_unchecked() const -> T
+      {
+         if constexpr( result_traits_size< T > == 1 ) {
+            return decode_unchecked< T >( 0 );
+         }
+         else {
+            return result_traits< T >::from( *this );
+         }
+      }
 
    public:
       [[nodiscard]] auto slice( const std::size_t offset, const std::size_t in_columns ) const -> row;
@@ -57,6 +120,7 @@ namespace tao::pq
 
       [[nodiscard]] auto name( const std::size_t column ) const -> std::string;
       [[nodiscard]] auto index( const internal::zsv in_name ) const -> std::size_t;
+      [[nodiscard]] auto index( const column_ref& in_name ) const -> std::size_t;
 
    private:
       class const_iterator
@@ -200,6 +264,14 @@ namespace tao::pq
       [[nodiscard]] auto is_null( const std::size_t column ) const -> bool;
       [[nodiscard]] auto get( const std::size_t column ) const -> const char*;
 
+      // no range checks, the caller has to ensure that the row and the column are valid
+      [[nodiscard]] auto is_null_unchecked( const std::size_t column ) const noexcept -> bool;
+      [[nodiscard]] auto get_unchecked( const std::size_t column ) const noexcept -> const char*;
+
+      [[nodiscard]] auto type( const std::size_t column ) const -> oid;
+      [[nodiscard]] auto is_binary( const std::size_t column ) const -> bool;
+      [[nodiscard]] auto length( const std::size_t column ) const -> std::size_t;
+
       template< typename T >
       [[nodiscard]] auto get( const std::size_t column ) const -> T
       {
@@ -208,18 +280,32 @@ namespace tao::pq
             TAO_PQ_UNREACHABLE;  // LCOV_EXCL_LINE
          }
          else if constexpr( result_traits_size< T > == 1 ) {
-            if constexpr( result_traits_has_null< T > ) {
-               if( is_null( column ) ) {
-                  return result_traits< T >::null();
+            ensure_field( column );
+            if constexpr( !result_traits_has_binary< T > ) {
+               if( is_binary_unchecked( column ) ) {
+                  throw_binary_not_supported( internal::demangle< T >() );
                }
             }
-            return result_traits< T >::from( get( column ) );
+            return decode_unchecked< T >( column );
          }
          else {
             return result_traits< T >::from( slice( column, result_traits_size< T > ) );
          }
       }
 
+      // no range checks, the caller has to ensure that the row and the column are valid
+      template< typename T >
+      [[nodiscard]] auto get_unchecked( const std::size_t column ) const -> T
+      {
+         static_assert( result_traits_size< T > == 1, "tao::pq::result_traits<T>::size does not yield exactly one column for T, which is required for unchecked access" );
+         if constexpr( !result_traits_has_binary< T > ) {
+            if( is_binary_unchecked( column ) ) {
+               throw_binary_not_supported( internal::demangle< T >() );
+            }
+         }
+         return decode_unchecked< T >( column );
+      }
+
       template< typename T >
       [[nodiscard]] auto optional( const std::size_t column ) const
       {
@@ -272,6 +358,16 @@ namespace tao::pq
          return ( *this )[ row::index( in_name ) ];
       }
 
+      [[nodiscard]] auto at( const column_ref& in_name ) const -> field
+      {
+         return ( *this )[ row::index( in_name ) ];
+      }
+
+      [[nodiscard]] auto operator[]( const column_ref& in_name ) const -> field
+      {
+         return ( *this )[ row::index( in_name ) ];
+      }
+
       friend void swap( row& lhs, row& rhs ) noexcept
       {
          std::swap( lhs.m_result, rhs.m_result );
@@ -0,0 +1,205 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_ROW_STREAM_HPP
+#define TAO_PQ_ROW_STREAM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <tao/pq/column_ref.hpp>
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result.hpp>
+#include <tao/pq/row.hpp>
+#include <tao/pq/transaction.hpp>
+
+namespace tao::pq
+{
+   class row_stream final
+   {
+   protected:
+      std::shared_ptr< transaction > m_previous;
+      std::shared_ptr< transaction > m_transaction;
+      std::optional< result > m_result;
+      std::size_t m_row = 0;
+      bool m_autocommit = false;
+
+      [[nodiscard]] static auto is_autocommit( const transaction& tr ) noexcept -> bool;
+
+      void set_mode( const std::size_t chunk_size );
+      auto fetch() -> bool;
+      void cancel() noexcept;
+
+   public:
+      // single-row mode
+      template< typename... As >
+      row_stream( const std::shared_ptr< transaction >& transaction, const internal::zsv statement, As&&... as )
+         : row_stream( transaction, 1, statement, std::forward< As >( as )... )
+      {}
+
+      // chunked mode, requires libpq 17 or newer, otherwise falls back to single-row mode
+      template< typename... As >
+      row_stream( const std::shared_ptr< transaction >& transaction, const std::size_t chunk_size, const internal::zsv statement, As&&... as )
+         : m_previous( transaction ),
+           m_transaction( std::make_shared< internal::transaction_guard >( transaction->connection() ) )
+      {
+         m_autocommit = row_stream::is_autocommit( *transaction );
+         m_transaction->send( statement, std::forward< As >( as )... );
+         try {
+            set_mode( chunk_size );
+            (void)fetch();
+         }
+         catch( ... ) {
+            // the destructor is not called, the statement must not remain pending
+            cancel();
+            throw;
+         }
+      }
+
+      ~row_stream();
+
+      row_stream( const row_stream& ) = delete;
+      row_stream( row_stream&& ) = delete;
+      void operator=( const row_stream& ) = delete;
+      void operator=( row_stream&& ) = delete;
+
+      [[nodiscard]] auto columns() const noexcept -> std::size_t
+      {
+         return m_result->columns();
+      }
+
+      [[nodiscard]] auto name( const std::size_t column ) const -> std::string
+      {
+         return m_result->name( column );
+      }
+
+      [[nodiscard]] auto index( const internal::zsv in_name ) const -> std::size_t
+      {
+         return m_result->index( in_name );
+      }
+
+      [[nodiscard]] auto index( const column_ref& in_name ) const -> std::size_t
+      {
+         return m_result->index( in_name );
+      }
+
+      [[nodiscard]] auto has_row() const noexcept -> bool
+      {
+         return m_result && ( m_row < m_result->m_rows );
+      }
+
+      // the row is valid until the next call to next()
+      [[nodiscard]] auto row() const noexcept -> pq::row
+      {
+         return ( *m_result )[ m_row ];
+      }
+
+      auto next() -> bool
+      {
+         if( ++m_row < m_result->m_rows ) {
+            return true;
+         }
+         return m_transaction && fetch();
+      }
+
+   private:
+      class const_iterator
+         : private pq::row
+      {
+      private:
+         friend class row_stream;
+
+         row_stream* m_stream;
+
+         explicit const_iterator( row_stream* stream ) noexcept
+            : m_stream( stream )
+         {
+            if( m_stream != nullptr ) {
+               if( m_stream->has_row() ) {
+                  static_cast< pq::row& >( *this ) = m_stream->row();
+               }
+               else {
+                  m_stream = nullptr;
+               }
+            }
+         }
+
+      public:
+         using difference_type = std::int32_t;
+         using value_type = const pq::row;
+         using pointer = const pq::row*;
+         using reference = const pq::row&;
+         using iterator_category = std::input_iterator_tag;
+
+         auto operator++() -> const_iterator&
+         {
+            if( m_stream->next() ) {
+               static_cast< pq::row& >( *this ) = m_stream->row();
+            }
+            else {
+               m_stream = nullptr;
+            }
+            return *this;
+         }
+
+         auto operator++( int ) -> const_iterator
+         {
+            return ++const_iterator( *this );
+         }
+
+         [[nodiscard]] auto operator*() const noexcept -> const pq::row&
+         {
+            return *this;
+         }
+
+         [[nodiscard]] auto operator->() const noexcept -> const pq::row*
+         {
+            return this;
+         }
+
+         [[nodiscard]] friend auto operator==( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_stream == rhs.m_stream;
+         }
+
+         [[nodiscard]] friend auto operator!=( const const_iterator& lhs, const const_iterator& rhs ) noexcept
+         {
+            return lhs.m_stream != rhs.m_stream;
+         }
+      };
+
+   public:
+      [[nodiscard]] auto begin() noexcept -> const_iterator
+      {
+         return const_iterator( this );
+      }
+
+      [[nodiscard]] auto end() noexcept -> const_iterator
+      {
+         return const_iterator( nullptr );
+      }
+   };
+
+   // implemented here as we need the complete type of row_stream
+   template< typename... As >
+   auto transaction::stream( const internal::zsv statement, As&&... as ) -> row_stream
+   {
+      check_current_transaction();
+      return row_stream( shared_from_this(), statement, std::forward< As >( as )... );
+   }
+
+   template< typename... As >
+   auto transaction::stream( const std::size_t chunk_size, const internal::zsv statement, As&&... as ) -> row_stream
+   {
+      check_current_transaction();
+      return row_stream( shared_from_this(), chunk_size, statement, std::forward< As >( as )... );
+   }
+
+}  // namespace tao::pq
+
+#endif
@@ -0,0 +1,104 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef TAO_PQ_SHARDED_POOL_HPP
+#define TAO_PQ_SHARDED_POOL_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/async_result.hpp>
+#include <tao/pq/connection.hpp>
+#include <tao/pq/connection_pool.hpp>
+#include <tao/pq/internal/zsv.hpp>
+#include <tao/pq/result.hpp>
+
+namespace tao::pq
+{
+   // routes keys, e.g. tenant ids, to one of several connection pools
+   class sharded_pool final
+   {
+   public:
+      // maps a key to the index of a shard
+      using router = std::function< std::size_t( const std::string_view ) >;
+
+   private:
+      const std::vector< std::shared_ptr< connection_pool > > m_shards;
+      const router m_router;
+
+      // pass-key idiom
+      class private_key final
+      {
+         private_key() = default;
+         friend class sharded_pool;
+      };
+
+   public:
+      sharded_pool( const private_key /*unused*/, std::vector< std::shared_ptr< connection_pool > > shards, router r );
+
+      sharded_pool( const sharded_pool& ) = delete;
+      sharded_pool( sharded_pool&& ) = delete;
+      void operator=( const sharded_pool& ) = delete;
+      void operator=( sharded_pool&& ) = delete;
+
+      ~sharded_pool() = default;
+
+      // uses a consistent hash ring to route keys
+      [[nodiscard]] static auto create( const std::vector< std::string >& connection_infos, const std::size_t max_size = 0, const std::size_t min_idle = 0 ) -> std::shared_ptr< sharded_pool >;
+      [[nodiscard]] static auto create( const std::vector< std::string >& connection_infos, router r, const std::size_t max_size = 0, const std::size_t min_idle = 0 ) -> std::shared_ptr< sharded_pool >;
+
+      [[nodiscard]] auto shards() const noexcept -> const std::vector< std::shared_ptr< connection_pool > >&
+      {
+         return m_shards;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t
+      {
+         return m_shards.size();
+      }
+
+      [[nodiscard]] auto shard( const std::string_view key ) const -> std::size_t;
+
+      [[nodiscard]] auto pool( const std::string_view key ) const -> const std::shared_ptr< connection_pool >&
+      {
+         return m_shards[ shard( key ) ];
+      }
+
+      [[nodiscard]] auto connection( const std::string_view key ) const -> std::shared_ptr< pq::connection >
+      {
+         return pool( key )->connection();
+      }
+
+      template< typename... As >
+      auto execute( const std::string_view key, const internal::zsv statement, As&&... as )
+      {
+         return connection( key )->direct()->execute( statement, std::forward< As >( as )... );
+      }
+
+      // executes the statement on all shards concurrently, the results are in the order of the shards
+      template< typename... As >
+      [[nodiscard]] auto execute_all( const internal::zsv statement, const As&... as ) -> std::vector< result >
+      {
+         std::vector< async_result > pending;
+         pending.reserve( m_shards.size() );
+         for( const auto& p : m_shards ) {
+            pending.emplace_back( p->connection()->direct()->async_execute( statement, as... ) );
+         }
+         std::vector< result > nrv;
+         nrv.reserve( pending.size() );
+         for( auto& r : pending ) {
+            nrv.emplace_back( r.get() );
+         }
+         return nrv;
+      }
+   };
+
+}  // namespace tao::pq
+
+#endif
@@ -9,6 +9,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -34,6 +35,8 @@ namespace tao::pq
       std::unique_ptr< char, decltype( &PQfreemem ) > m_buffer;
       std::vector< const char* > m_data;
 
+      [[nodiscard]] auto get_copy_data( const bool async ) -> std::optional< std::string_view >;
+
    public:
       template< typename... As >
       table_reader( const std::shared_ptr< transaction >& transaction, const internal::zsv statement, As&&... as )
@@ -55,6 +58,11 @@ namespace tao::pq
          return m_result.columns();
       }
 
+      [[nodiscard]] auto connection() const noexcept -> const std::shared_ptr< pq::connection >&
+      {
+         return m_transaction->connection();
+      }
+
       // note: the following API is experimental and subject to change
 
       [[nodiscard]] auto get_raw_data() -> std::string_view;
@@ -66,6 +74,17 @@ namespace tao::pq
          return parse_data();
       }
 
+      // non-blocking, returns std::nullopt when no complete row is available yet
+      [[nodiscard]] auto try_get_raw_data() -> std::optional< std::string_view >;
+
+      [[nodiscard]] auto try_get_row() -> std::optional< bool >
+      {
+         if( !try_get_raw_data() ) {
+            return std::nullopt;
+         }
+         return parse_data();
+      }
+
       [[nodiscard]] auto has_data() const noexcept -> bool
       {
          return !m_data.empty();
@@ -6,6 +6,7 @@
 #define TAO_PQ_TABLE_WRITER_HPP
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -24,6 +25,9 @@ namespace tao::pq
    protected:
       std::shared_ptr< transaction > m_previous;
       std::shared_ptr< transaction > m_transaction;
+      bool m_end_sent = false;
+
+      [[nodiscard]] auto finish() -> std::size_t;
 
       template< std::size_t... Os, std::size_t... Is, typename... Ts >
       void insert_indexed( std::index_sequence< Os... > /*unused*/,
@@ -68,7 +72,15 @@ namespace tao::pq
          return insert_traits( parameter_traits< std::decay_t< As > >( std::forward< As >( as ) )... );
       }
 
+      [[nodiscard]] auto connection() const noexcept -> const std::shared_ptr< pq::connection >&
+      {
+         return m_transaction->connection();
+      }
+
       auto commit() -> std::size_t;
+
+      // non-blocking, returns std::nullopt when the server did not yet confirm the commit
+      [[nodiscard]] auto try_commit() -> std::optional< std::size_t >;
    };
 
 }  // namespace tao::pq
@@ -15,15 +15,20 @@
 
 #include <libpq-fe.h>
 
+#include <tao/pq/internal/exclusive_scan.hpp>
 #include <tao/pq/internal/gen.hpp>
 #include <tao/pq/internal/zsv.hpp>
 #include <tao/pq/oid.hpp>
 #include <tao/pq/parameter_traits.hpp>
+#include <tao/pq/prepared_statement.hpp>
 #include <tao/pq/result.hpp>
 
 namespace tao::pq
 {
+   class async_result;
    class connection;
+   class pipeline;
+   class row_stream;
    class table_reader;
    class table_writer;
 
@@ -33,6 +38,9 @@ namespace tao::pq
    protected:
       std::shared_ptr< pq::connection > m_connection;
 
+      friend class async_result;
+      friend class pipeline;
+      friend class row_stream;
       friend class table_reader;
       friend class table_writer;
 
@@ -97,6 +105,77 @@ namespace tao::pq
          }
       }
 
+      [[nodiscard]] auto execute_prepared( const result::mode_t mode,
+                                           const char* name,
+                                           const int n_params,
+                                           const char* const values[],
+                                           const int lengths[],
+                                           const int formats[] ) -> result;
+
+      template< std::size_t... Os, std::size_t... Is, typename... Ts >
+      [[nodiscard]] auto execute_prepared_indexed( const char* name,
+                                                   std::index_sequence< Os... > /*unused*/,
+                                                   std::index_sequence< Is... > /*unused*/,
+                                                   const std::tuple< Ts... >& tuple )
+      {
+         const char* const values[] = { std::get< Os >( tuple ).template value< Is >()... };
+         const int lengths[] = { std::get< Os >( tuple ).template length< Is >()... };
+         const int formats[] = { std::get< Os >( tuple ).template format< Is >()... };
+         return execute_prepared( result::mode_t::expect_ok, name, sizeof...( Os ), values, lengths, formats );
+      }
+
+      template< typename... Ps >
+      [[nodiscard]] auto execute_prepared_traits( const char* name, const Ps&... ps )
+      {
+         using gen = internal::gen< Ps::columns... >;
+         return transaction::execute_prepared_indexed( name, typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ps... ) );
+      }
+
+      template< typename... Ts, std::size_t... Ns, typename... As >
+      [[nodiscard]] auto execute_prepared_offsets( const prepared_statement< Ts... >& statement, std::index_sequence< Ns... > /*unused*/, As&&... as )
+      {
+         static_assert( ( internal::is_non_narrowing< Ts, As > && ... ), "narrowing conversion of an argument for a prepared statement parameter" );
+         return transaction::execute_prepared_traits( statement.name().c_str(), internal::prepared_parameter< Ts >( std::forward< As >( as ), statement.types().data() + Ns )... );
+      }
+
+      void send_params( const char* statement,
+                        const int n_params,
+                        const Oid types[],
+                        const char* const values[],
+                        const int lengths[],
+                        const int formats[] );
+
+      template< std::size_t... Os, std::size_t... Is, typename... Ts >
+      void send_indexed( const char* statement,
+                         std::index_sequence< Os... > /*unused*/,
+                         std::index_sequence< Is... > /*unused*/,
+                         const std::tuple< Ts... >& tuple )
+      {
+         const Oid types[] = { static_cast< Oid >( std::get< Os >( tuple ).template type< Is >() )... };
+         const char* const values[] = { std::get< Os >( tuple ).template value< Is >()... };
+         const int lengths[] = { std::get< Os >( tuple ).template length< Is >()... };
+         const int formats[] = { std::get< Os >( tuple ).template format< Is >()... };
+         send_params( statement, sizeof...( Os ), types, values, lengths, formats );
+      }
+
+      template< typename... Ts >
+      void send_traits( const char* statement, const Ts&... ts )
+      {
+         using gen = internal::gen< Ts::columns... >;
+         transaction::send_indexed( statement, typename gen::outer_sequence(), typename gen::inner_sequence(), std::tie( ts... ) );
+      }
+
+      template< typename... As >
+      void send( const char* statement, As&&... as )
+      {
+         if constexpr( sizeof...( As ) == 0 ) {
+            send_params( statement, 0, nullptr, nullptr, nullptr, nullptr );
+         }
+         else {
+            send_traits( statement, parameter_traits< std::decay_t< As > >( std::forward< As >( as ) )... );
+         }
+      }
+
    public:
       [[nodiscard]] auto connection() const noexcept -> const std::shared_ptr< pq::connection >&
       {
@@ -111,6 +190,30 @@ namespace tao::pq
          return transaction::execute_mode( result::mode_t::expect_ok, statement, std::forward< As >( as )... );
       }
 
+      template< typename... Ts, typename... As >
+      auto execute( const prepared_statement< Ts... >& statement, As&&... as )
+      {
+         static_assert( sizeof...( As ) == sizeof...( Ts ), "wrong number of parameters for prepared statement" );
+         if constexpr( sizeof...( Ts ) == 0 ) {
+            return transaction::execute_prepared( result::mode_t::expect_ok, statement.name().c_str(), 0, nullptr, nullptr, nullptr );
+         }
+         else {
+            using offsets = internal::exclusive_scan_t< std::index_sequence< internal::prepared_parameter< Ts >::columns... > >;
+            return transaction::execute_prepared_offsets( statement, offsets(), std::forward< As >( as )... );
+         }
+      }
+
+      // implemented in async_result.hpp
+      template< typename... As >
+      [[nodiscard]] auto async_execute( const internal::zsv statement, As&&... as ) -> async_result;
+
+      // implemented in row_stream.hpp
+      template< typename... As >
+      [[nodiscard]] auto stream( const internal::zsv statement, As&&... as ) -> row_stream;
+
+      template< typename... As >
+      [[nodiscard]] auto stream( const std::size_t chunk_size, const internal::zsv statement, As&&... as ) -> row_stream;
+
       void commit();
       void rollback();
 
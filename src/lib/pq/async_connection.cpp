@@ -0,0 +1,121 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/async_connection.hpp>
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <system_error>
+
+#include <tao/pq/exception.hpp>
+#include <tao/pq/internal/poll.hpp>
+
+namespace tao::pq
+{
+   async_connection::async_connection( const std::string& connection_info )
+      : m_pgconn( PQconnectStart( connection_info.c_str() ), &PQfinish )
+   {
+      if( !m_pgconn ) {
+         throw std::bad_alloc();  // LCOV_EXCL_LINE
+      }
+      if( PQstatus( m_pgconn.get() ) == CONNECTION_BAD ) {
+         throw pq::connection_error( PQerrorMessage( m_pgconn.get() ), "08000" );
+      }
+
+      // PQconnectPoll() does not enforce connect_timeout, so we do it ourselves,
+      // with the same interpretation as libpq, i.e. values <= 0 disable the timeout
+      // and the minimum is 2 seconds
+      const std::unique_ptr< PQconninfoOption, decltype( &PQconninfoFree ) > options( PQconninfo( m_pgconn.get() ), &PQconninfoFree );
+      for( const auto* option = options.get(); ( option != nullptr ) && ( option->keyword != nullptr ); ++option ) {
+         if( ( std::strcmp( option->keyword, "connect_timeout" ) == 0 ) && ( option->val != nullptr ) ) {
+            const char* end = option->val + std::strlen( option->val );
+            int seconds = 0;
+            const auto [ ptr, ec ] = std::from_chars( option->val, end, seconds );
+            if( ( ec == std::errc() ) && ( ptr == end ) && ( seconds > 0 ) ) {
+               m_deadline = std::chrono::steady_clock::now() + std::chrono::seconds( std::max( seconds, 2 ) );
+            }
+            break;
+         }
+      }
+   }
+
+   void async_connection::check_pending() const
+   {
+      if( !m_pgconn ) {
+         throw std::logic_error( "async connection already retrieved" );
+      }
+   }
+
+   auto async_connection::remaining_ms() const -> int
+   {
+      if( m_deadline == std::chrono::steady_clock::time_point::max() ) {
+         return -1;
+      }
+      const auto remaining = std::chrono::ceil< std::chrono::milliseconds >( m_deadline - std::chrono::steady_clock::now() ).count();
+      if( remaining <= 0 ) {
+         throw pq::connection_error( "timeout expired while connecting", "08000" );
+      }
+      return static_cast< int >( std::min< decltype( remaining ) >( remaining, INT_MAX ) );
+   }
+
+   void async_connection::advance()
+   {
+      m_status = PQconnectPoll( m_pgconn.get() );
+      if( m_status == PGRES_POLLING_FAILED ) {
+         throw pq::connection_error( PQerrorMessage( m_pgconn.get() ), "08000" );
+      }
+   }
+
+   auto async_connection::release() -> PGconn*
+   {
+      check_pending();
+      return m_pgconn.release();
+   }
+
+   auto async_connection::socket() const -> int
+   {
+      check_pending();
+      return PQsocket( m_pgconn.get() );
+   }
+
+   auto async_connection::ready() -> bool
+   {
+      check_pending();
+      if( m_status == PGRES_POLLING_OK ) {
+         return true;
+      }
+      // libpq requires the socket to be ready before calling PQconnectPoll()
+      internal::pollfd pfd{};
+      pfd.fd = socket();
+      pfd.events = wants_write() ? POLLOUT : POLLIN;
+      if( internal::poll( &pfd, 1, 0 ) > 0 ) {
+         advance();
+      }
+      if( m_status == PGRES_POLLING_OK ) {
+         return true;
+      }
+      (void)remaining_ms();
+      return false;
+   }
+
+   auto async_connection::get() -> std::shared_ptr< connection >
+   {
+      check_pending();
+      while( m_status != PGRES_POLLING_OK ) {
+         internal::pollfd pfd{};
+         pfd.fd = socket();
+         pfd.events = wants_write() ? POLLOUT : POLLIN;
+         if( internal::poll( &pfd, 1, remaining_ms() ) > 0 ) {
+            advance();
+         }
+      }
+      return std::make_shared< connection >( connection::private_key(), release() );
+   }
+
+}  // namespace tao::pq
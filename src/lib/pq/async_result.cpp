@@ -0,0 +1,75 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/async_result.hpp>
+
+#include <stdexcept>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+
+namespace tao::pq
+{
+   void async_result::check_pending() const
+   {
+      if( !m_transaction ) {
+         throw std::logic_error( "async result already retrieved" );
+      }
+   }
+
+   async_result::~async_result()
+   {
+      if( m_transaction ) {
+         // the statement was already sent, we need to consume
+         // its result before the connection can be used again
+         PGconn* pgconn = m_transaction->connection()->underlying_raw_ptr();
+         while( PGresult* pgresult = PQgetResult( pgconn ) ) {
+            const auto status = PQresultStatus( pgresult );
+            PQclear( pgresult );
+            // LCOV_EXCL_START
+            if( ( status == PGRES_COPY_IN ) || ( status == PGRES_COPY_OUT ) ) {
+               break;
+            }
+            // LCOV_EXCL_STOP
+         }
+      }
+   }
+
+   auto async_result::connection() const -> const std::shared_ptr< pq::connection >&
+   {
+      check_pending();
+      return m_transaction->connection();
+   }
+
+   auto async_result::socket() const -> int
+   {
+      check_pending();
+      return m_transaction->connection()->socket();
+   }
+
+   auto async_result::ready() -> bool
+   {
+      check_pending();
+      const auto& connection = m_transaction->connection();
+      if( !m_flushed ) {
+         m_flushed = connection->flush();
+         if( !m_flushed ) {
+            return false;
+         }
+      }
+      connection->consume_input();
+      return !connection->is_busy();
+   }
+
+   auto async_result::get() -> result
+   {
+      check_pending();
+      // release the guards on all paths, including exceptions
+      const auto previous = std::move( m_previous );
+      const auto transaction = std::move( m_transaction );
+      return transaction->connection()->get_result( result::mode_t::expect_ok );
+   }
+
+}  // namespace tao::pq
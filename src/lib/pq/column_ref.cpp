@@ -0,0 +1,43 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/column_ref.hpp>
+
+namespace tao::pq
+{
+   column_ref::column_ref( const std::string_view in_name )
+   {
+      // same rules as PQfnumber(): quoted parts are taken verbatim with "" as an
+      // escaped quote, everything else is folded to lower case
+      m_name.reserve( in_name.size() );
+      bool in_quotes = false;
+      for( std::size_t pos = 0; pos < in_name.size(); ++pos ) {
+         const char c = in_name[ pos ];
+         if( in_quotes ) {
+            if( c == '"' ) {
+               if( ( pos + 1 < in_name.size() ) && ( in_name[ pos + 1 ] == '"' ) ) {
+                  m_name += '"';
+                  ++pos;
+               }
+               else {
+                  in_quotes = false;
+               }
+            }
+            else {
+               m_name += c;
+            }
+         }
+         else if( c == '"' ) {
+            in_quotes = true;
+         }
+         else if( ( c >= 'A' ) && ( c <= 'Z' ) ) {
+            m_name += static_cast< char >( c - 'A' + 'a' );
+         }
+         else {
+            m_name += c;
+         }
+      }
+   }
+
+}  // namespace tao::pq
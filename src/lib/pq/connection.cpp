@@ -4,6 +4,7 @@
 
 #include <tao/pq/connection.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cctype>
 #include <cstring>
@@ -11,7 +12,9 @@
 #include <stdexcept>
 #include <string>
 
+#include <tao/pq/async_connection.hpp>
 #include <tao/pq/exception.hpp>
+#include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/unreachable.hpp>
 #include <tao/pq/notification.hpp>
 #include <tao/pq/oid.hpp>
@@ -153,6 +156,11 @@ namespace tao::pq
          }
       };
 
+      [[nodiscard]] constexpr auto is_identifier_char( const char c ) noexcept -> bool
+      {
+         return ( ( c >= 'a' ) && ( c <= 'z' ) ) || ( ( c >= 'A' ) && ( c <= 'Z' ) ) || ( ( c >= '0' ) && ( c <= '9' ) ) || ( c == '_' );
+      }
+
       [[nodiscard]] constexpr auto is_identifier( const std::string_view value ) noexcept -> bool
       {
          return !value.empty() && ( value.find_first_not_of( "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_" ) == std::string_view::npos ) && ( std::isdigit( value[ 0 ] ) == 0 );
@@ -176,9 +184,128 @@ namespace tao::pq
       }
    }
 
-   auto connection::is_prepared( const std::string_view name ) const noexcept -> bool
+   auto connection::is_prepared( const char* name ) const noexcept -> bool
    {
-      return m_prepared_statements.find( name ) != m_prepared_statements.end();
+      if( m_prepared_statements.empty() ) {
+         return false;
+      }
+      // this is called for every statement, which is usually SQL text and not the name of a
+      // prepared statement; those are rejected by the first character that can not be part
+      // of a name or when they are longer than any name, without scanning the whole text
+      std::size_t size = 0;
+      while( name[ size ] != '\0' ) {
+         if( ( size == m_prepared_name_size ) || !pq::is_identifier_char( name[ size ] ) ) {
+            return false;
+         }
+         ++size;
+      }
+      return m_prepared_statements.find( std::string_view( name, size ) ) != m_prepared_statements.end();
+   }
+
+   auto connection::prepared_text( const std::string_view name ) const noexcept -> const std::string*
+   {
+      const auto it = m_prepared_statements.find( name );
+      return ( it != m_prepared_statements.end() ) ? &it->second->second : nullptr;
+   }
+
+   auto connection::auto_prepare( const char* statement, const int n_params, const Oid types[] ) -> const char*
+   {
+      const std::string_view sv = statement;
+      const auto it = m_auto_prepared_index.find( sv );
+      std::list< auto_prepared_statement >::iterator pos;
+      if( it == m_auto_prepared_index.end() ) {
+         // new statements only displace other candidates, never prepared statements
+         if( m_auto_prepare_candidates.size() >= m_auto_prepare_capacity ) {
+            auto_evict_candidate();
+         }
+         m_auto_prepare_candidates.push_front( { std::string( sv ), std::string(), std::vector< Oid >(), 1 } );
+         pos = m_auto_prepare_candidates.begin();
+         m_auto_prepared_index.emplace( pos->statement, pos );
+      }
+      else {
+         pos = it->second;
+         auto& list = pos->name.empty() ? m_auto_prepare_candidates : m_auto_prepared_statements;
+         list.splice( list.begin(), list, pos );
+         ++pos->executions;
+      }
+
+      auto& entry = *pos;
+      if( entry.name.empty() ) {
+         if( entry.executions <= m_auto_prepare_threshold ) {
+            return nullptr;
+         }
+         std::string name = internal::printf( "taopq auto %zu", ++m_auto_prepare_counter );
+         (void)result( PQprepare( m_pgconn.get(), name.c_str(), statement, n_params, types ) );
+         entry.name = std::move( name );
+         entry.types.assign( types, types + n_params );
+         m_auto_prepared_statements.splice( m_auto_prepared_statements.begin(), m_auto_prepare_candidates, pos );
+         while( m_auto_prepared_statements.size() > m_auto_prepare_capacity ) {
+            auto_evict();
+         }
+         return entry.name.c_str();
+      }
+
+      // the statement was prepared for these parameter types only
+      if( ( entry.types.size() != static_cast< std::size_t >( n_params ) ) || !std::equal( entry.types.begin(), entry.types.end(), types ) ) {
+         return nullptr;
+      }
+      return entry.name.c_str();
+   }
+
+   void connection::auto_evict()
+   {
+      auto& lru = m_auto_prepared_statements.back();
+      // the current transaction might be aborted or results might be pending,
+      // so the statement is deallocated later, see deallocate_evicted()
+      m_evicted_statements.emplace_back( std::move( lru.name ) );
+      m_auto_prepared_index.erase( lru.statement );
+      m_auto_prepared_statements.pop_back();
+   }
+
+   void connection::auto_evict_candidate() noexcept
+   {
+      m_auto_prepared_index.erase( m_auto_prepare_candidates.back().statement );
+      m_auto_prepare_candidates.pop_back();
+   }
+
+   void connection::deallocate_evicted()
+   {
+      if( m_evicted_statements.empty() ) {
+         return;
+      }
+      // only outside of transactions and when nothing is in flight
+      PGconn* pgconn = m_pgconn.get();
+      if( ( PQtransactionStatus( pgconn ) != PQTRANS_IDLE ) || ( PQpipelineStatus( pgconn ) != PQ_PIPELINE_OFF ) || ( PQisBusy( pgconn ) != 0 ) ) {
+         return;
+      }
+      for( const auto& name : m_evicted_statements ) {
+         // errors are ignored, the generated name is never used again
+         PQclear( PQexec( pgconn, ( "DEALLOCATE " + escape_identifier( name ) ).c_str() ) );
+      }
+      m_evicted_statements.clear();
+   }
+
+   void connection::forget_prepared_statements() noexcept
+   {
+      m_prepared_statements.clear();
+      m_prepared_texts.clear();
+      m_prepared_name_size = 0;
+      m_auto_prepared_index.clear();
+      m_auto_prepared_statements.clear();
+      m_auto_prepare_candidates.clear();
+      m_evicted_statements.clear();
+   }
+
+   void connection::reset_auto_prepare() noexcept
+   {
+      while( !m_auto_prepared_statements.empty() ) {
+         auto_evict();
+      }
+      while( !m_auto_prepare_candidates.empty() ) {
+         auto_evict_candidate();
+      }
+      m_auto_prepare_threshold = 0;
+      m_auto_prepare_capacity = 0;
    }
 
    auto connection::execute_final( const result::mode_t mode,
@@ -190,9 +317,19 @@ namespace tao::pq
                                    const int formats[] ) -> result
    {
       if( is_prepared( statement ) ) {
-         return result( PQexecPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, 0 ), mode );
+         return result( PQexecPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, static_cast< int >( m_result_format ) ), mode );
+      }
+      if( m_auto_prepare_capacity != 0 ) {
+         const char* name = auto_prepare( statement, n_params, types );
+         deallocate_evicted();
+         if( name != nullptr ) {
+            return result( PQexecPrepared( m_pgconn.get(), name, n_params, values, lengths, formats, static_cast< int >( m_result_format ) ), mode );
+         }
+      }
+      else {
+         deallocate_evicted();
       }
-      return result( PQexecParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, 0 ), mode );
+      return result( PQexecParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, static_cast< int >( m_result_format ) ), mode );
    }
 
    auto connection::execute_params( const result::mode_t mode,
@@ -208,11 +345,60 @@ namespace tao::pq
       return nrv;
    }
 
+   auto connection::execute_prepared( const result::mode_t mode,
+                                      const char* name,
+                                      const int n_params,
+                                      const char* const values[],
+                                      const int lengths[],
+                                      const int formats[] ) -> result
+   {
+      result nrv( PQexecPrepared( m_pgconn.get(), name, n_params, values, lengths, formats, static_cast< int >( m_result_format ) ), mode );
+      handle_notifications();
+      return nrv;
+   }
+
    auto connection::execute_single( const internal::zsv statement ) -> result
    {
       return execute_params( result::mode_t::expect_ok, statement, 0, nullptr, nullptr, nullptr, nullptr );
    }
 
+   void connection::send_params( const char* statement,
+                                 const int n_params,
+                                 const Oid types[],
+                                 const char* const values[],
+                                 const int lengths[],
+                                 const int formats[] )
+   {
+      if( is_prepared( statement ) ) {
+         if( PQsendQueryPrepared( m_pgconn.get(), statement, n_params, values, lengths, formats, static_cast< int >( m_result_format ) ) == 0 ) {
+            throw std::runtime_error( "PQsendQueryPrepared() failed: " + error_message() );
+         }
+      }
+      else {
+         if( PQsendQueryParams( m_pgconn.get(), statement, n_params, types, values, lengths, formats, static_cast< int >( m_result_format ) ) == 0 ) {
+            throw std::runtime_error( "PQsendQueryParams() failed: " + error_message() );
+         }
+      }
+   }
+
+   auto connection::get_result( const result::mode_t mode ) -> result
+   {
+      PGresult* pgresult = PQgetResult( m_pgconn.get() );
+      if( pgresult == nullptr ) {
+         throw pq::connection_error( error_message().c_str(), "08000" );  // LCOV_EXCL_LINE
+      }
+      const auto status = PQresultStatus( pgresult );
+      if( ( status != PGRES_COPY_IN ) && ( status != PGRES_COPY_OUT ) ) {
+         // consume the end-of-results marker
+         while( PGresult* next = PQgetResult( m_pgconn.get() ) ) {
+            PQclear( next );  // LCOV_EXCL_LINE
+         }
+      }
+      result nrv( pgresult, mode );
+      handle_notifications();
+      return nrv;
+   }
+
    connection::connection( const private_key /*unused*/, const std::string& connection_info )
       : m_pgconn( PQconnectdb( connection_info.c_str() ), &PQfinish ),
         m_current_transaction( nullptr )
@@ -224,11 +410,25 @@ namespace tao::pq
       }
    }
 
+   connection::connection( const private_key /*unused*/, PGconn* pgconn )
+      : m_pgconn( pgconn, &PQfinish ),
+        m_current_transaction( nullptr )
+   {
+      if( !is_open() ) {
+         throw pq::connection_error( PQerrorMessage( m_pgconn.get() ), "08000" );  // LCOV_EXCL_LINE
+      }
+   }
+
    auto connection::create( const std::string& connection_info ) -> std::shared_ptr< connection >
    {
       return std::make_shared< connection >( private_key(), connection_info );
    }
 
+   auto connection::create_async( const std::string& connection_info ) -> async_connection
+   {
+      return async_connection( connection_info );
+   }
+
    auto connection::error_message() const -> std::string
    {
       return PQerrorMessage( m_pgconn.get() );
@@ -273,6 +473,50 @@ namespace tao::pq
       return PQstatus( m_pgconn.get() ) == CONNECTION_OK;
    }
 
+   auto connection::socket() const -> int
+   {
+      const int fd = PQsocket( m_pgconn.get() );
+      if( fd < 0 ) {
+         throw pq::connection_error( "no server connection", "08000" );  // LCOV_EXCL_LINE
+      }
+      return fd;
+   }
+
+   auto connection::is_nonblocking() const noexcept -> bool
+   {
+      return PQisnonblocking( m_pgconn.get() ) != 0;
+   }
+
+   void connection::set_nonblocking( const bool enable )
+   {
+      if( PQsetnonblocking( m_pgconn.get(), enable ? 1 : 0 ) != 0 ) {
+         throw std::runtime_error( "PQsetnonblocking() failed: " + error_message() );  // LCOV_EXCL_LINE
+      }
+   }
+
+   auto connection::flush() -> bool
+   {
+      switch( PQflush( m_pgconn.get() ) ) {
+         case 0:
+            return true;
+         case 1:
+            return false;  // LCOV_EXCL_LINE
+      }
+      throw pq::connection_error( error_message().c_str(), "08000" );  // LCOV_EXCL_LINE
+   }
+
+   void connection::consume_input()
+   {
+      if( PQconsumeInput( m_pgconn.get() ) == 0 ) {
+         throw pq::connection_error( error_message().c_str(), "08000" );
+      }
+   }
+
+   auto connection::is_busy() const noexcept -> bool
+   {
+      return PQisBusy( m_pgconn.get() ) != 0;
+   }
+
    auto connection::direct() -> std::shared_ptr< pq::transaction >
    {
       return std::make_shared< autocommit_transaction >( shared_from_this() );
@@ -297,18 +541,57 @@ namespace tao::pq
    {
       connection::check_prepared_name( name );
       (void)result( PQprepare( m_pgconn.get(), name.c_str(), statement.c_str(), 0, nullptr ) );
-      m_prepared_statements.insert( name );
+      m_prepared_texts.emplace_front( name, statement );
+      m_prepared_statements.emplace( m_prepared_texts.front().first, m_prepared_texts.begin() );
+      m_prepared_name_size = std::max( m_prepared_name_size, name.size() );
       handle_notifications();
    }
 
+   auto connection::prepare_described( const std::string& name, const std::string& statement, const std::size_t parameters ) -> std::vector< Oid >
+   {
+      prepare( name, statement );
+      const result description( PQdescribePrepared( m_pgconn.get(), name.c_str() ) );
+      const auto n = static_cast< std::size_t >( PQnparams( description.m_pgresult.get() ) );
+      if( n != parameters ) {
+         deallocate( name );
+         throw std::invalid_argument( internal::printf( "prepared statement %s has %zu parameters, not %zu", name.c_str(), n, parameters ) );
+      }
+      std::vector< Oid > types( n );
+      for( std::size_t i = 0; i < n; ++i ) {
+         types[ i ] = PQparamtype( description.m_pgresult.get(), static_cast< int >( i ) );
+      }
+      return types;
+   }
+
    void connection::deallocate( const std::string& name )
    {
       connection::check_prepared_name( name );
-      if( !connection::is_prepared( name ) ) {
+      if( !connection::is_prepared( name.c_str() ) ) {
          throw std::runtime_error( "prepared statement not found: " + name );
       }
       (void)connection::execute_single( "DEALLOCATE " + escape_identifier( name ) );
-      m_prepared_statements.erase( name );
+      const auto it = m_prepared_statements.find( name );
+      const auto pos = it->second;
+      m_prepared_statements.erase( it );
+      m_prepared_texts.erase( pos );
+   }
+
+   auto connection::auto_prepared_statements() const noexcept -> std::size_t
+   {
+      return m_auto_prepared_statements.size();
+   }
+
+   void connection::set_auto_prepare( const std::size_t threshold, const std::size_t capacity )
+   {
+      while( m_auto_prepared_statements.size() > capacity ) {
+         auto_evict();
+      }
+      while( m_auto_prepare_candidates.size() > capacity ) {
+         auto_evict_candidate();
+      }
+      deallocate_evicted();
+      m_auto_prepare_threshold = threshold;
+      m_auto_prepare_capacity = capacity;
    }
 
    void connection::listen( const std::string_view channel )
@@ -357,10 +640,34 @@ namespace tao::pq
 
    void connection::get_notifications()
    {
-      if( PQconsumeInput( m_pgconn.get() ) == 0 ) {
-         throw pq::connection_error( PQerrorMessage( m_pgconn.get() ), "08000" );
-      }
+      consume_input();
       handle_notifications();
    }
 
+   auto connection::pipeline_status() const noexcept -> pq::pipeline_status
+   {
+      return static_cast< pq::pipeline_status >( PQpipelineStatus( m_pgconn.get() ) );
+   }
+
+   void connection::enter_pipeline_mode()
+   {
+      if( PQenterPipelineMode( m_pgconn.get() ) == 0 ) {
+         throw std::runtime_error( "unable to enter pipeline mode" );
+      }
+   }
+
+   void connection::exit_pipeline_mode()
+   {
+      if( PQexitPipelineMode( m_pgconn.get() ) == 0 ) {
+         throw std::runtime_error( "unable to exit pipeline mode: " + error_message() );
+      }
+   }
+
+   void connection::pipeline_sync()
+   {
+      if( PQpipelineSync( m_pgconn.get() ) == 0 ) {
+         throw std::runtime_error( "PQpipelineSync() failed: " + error_message() );
+      }
+   }
+
 }  // namespace tao::pq
@@ -4,15 +4,168 @@
 
 #include <tao/pq/connection_pool.hpp>
 
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/async_connection.hpp>
+#include <tao/pq/exception.hpp>
+#include <tao/pq/internal/poll.hpp>
+
 namespace tao::pq
 {
+   void connection_pool::prepare_pinned( pq::connection& c ) const
+   {
+      std::vector< std::pair< std::string, std::string > > pinned;
+      std::size_t generation = 0;
+      {
+         const std::lock_guard lock( m_session_mutex );
+         pinned = m_pinned_statements;
+         generation = m_pinned_generation.load();
+      }
+      for( const auto& [ name, statement ] : pinned ) {
+         connection_pool::prepare_pinned( c, name, statement );
+      }
+      c.m_pool_generation = generation;
+   }
+
+   void connection_pool::prepare_pinned( pq::connection& c, const std::string& name, const std::string& statement )
+   {
+      if( const std::string* text = c.prepared_text( name ) ) {
+         if( *text != statement ) {
+            throw std::invalid_argument( "prepared statement " + name + " conflicts with a pinned statement" );
+         }
+      }
+      else {
+         c.prepare( name, statement );
+      }
+   }
+
+   void connection_pool::prepare_borrowed( const std::shared_ptr< pq::connection >& c ) const
+   {
+      if( c->m_pool_generation != m_pinned_generation.load() ) {
+         try {
+            prepare_pinned( *c );
+         }
+         catch( ... ) {
+            // the connection would fail every later checkout, so it is not returned to the pool
+            connection_pool::detach( c );
+            throw;
+         }
+      }
+   }
+
    auto connection_pool::v_create() const -> std::unique_ptr< pq::connection >
    {
-      return std::make_unique< pq::connection >( pq::connection::private_key(), m_connection_info );
+      auto nrv = std::make_unique< pq::connection >( pq::connection::private_key(), m_connection_info );
+      prepare_pinned( *nrv );
+      return nrv;
+   }
+
+   auto connection_pool::v_create_many( const std::size_t n ) const -> std::vector< std::unique_ptr< pq::connection > >
+   {
+      std::vector< std::unique_ptr< pq::connection > > nrv;
+      nrv.reserve( n );
+      if( n == 1 ) {
+         nrv.emplace_back( v_create() );
+         return nrv;
+      }
+
+      // establish all connections concurrently
+      std::vector< async_connection > pending;
+      pending.reserve( n );
+      for( std::size_t i = 0; i < n; ++i ) {
+         pending.emplace_back( pq::connection::create_async( m_connection_info ) );
+      }
+
+      // ready() throws when a connection failed or its connect_timeout expired,
+      // which fails the whole batch and closes the other pending connections
+      std::vector< internal::pollfd > fds;
+      while( true ) {
+         fds.clear();
+         int timeout_ms = -1;
+         for( auto& c : pending ) {
+            if( !c.ready() ) {
+               internal::pollfd pfd{};
+               pfd.fd = c.socket();
+               pfd.events = c.wants_write() ? POLLOUT : POLLIN;
+               fds.push_back( pfd );
+               const int remaining = c.remaining_ms();
+               if( ( remaining >= 0 ) && ( ( timeout_ms < 0 ) || ( remaining < timeout_ms ) ) ) {
+                  timeout_ms = remaining;
+               }
+            }
+         }
+         if( fds.empty() ) {
+            break;
+         }
+         (void)internal::poll( fds.data(), fds.size(), timeout_ms );
+      }
+
+      for( auto& c : pending ) {
+         nrv.emplace_back( std::make_unique< pq::connection >( pq::connection::private_key(), c.release() ) );
+         prepare_pinned( *nrv.back() );
+      }
+      return nrv;
+   }
+
+   auto connection_pool::v_reset( pq::connection& c ) const noexcept -> bool
+   {
+      // client-side session state
+      c.m_notification_handler = nullptr;
+      c.m_notification_handlers.clear();
+      c.set_result_format( result_format::text_format );
+      c.reset_auto_prepare();
+      PGconn* pgconn = c.underlying_raw_ptr();
+      if( ( PQisnonblocking( pgconn ) != 0 ) && ( PQsetnonblocking( pgconn, 0 ) != 0 ) ) {
+         return false;  // LCOV_EXCL_LINE
+      }
+
+      std::shared_ptr< const std::string > statement;
+      bool discards = false;
+      {
+         const std::lock_guard lock( m_session_mutex );
+         statement = m_reset_statement;
+         discards = m_reset_discards_statements;
+      }
+      if( !statement ) {
+         return true;
+      }
+      const std::unique_ptr< PGresult, decltype( &PQclear ) > result( PQexec( pgconn, statement->c_str() ), &PQclear );
+      if( ( PQresultStatus( result.get() ) != PGRES_COMMAND_OK ) || ( PQtransactionStatus( pgconn ) != PQTRANS_IDLE ) ) {
+         return false;
+      }
+      if( discards ) {
+         // the server dropped the prepared statements, the pinned statements are prepared again on the next checkout
+         c.forget_prepared_statements();
+         c.m_pool_generation = 0;
+      }
+      return true;
+   }
+
+   auto connection_pool::v_probe( pq::connection& c ) const noexcept -> bool
+   {
+      if( !c.is_open() ) {
+         return false;
+      }
+      PGconn* pgconn = c.underlying_raw_ptr();
+      if( ( PQconsumeInput( pgconn ) == 0 ) || ( PQtransactionStatus( pgconn ) != PQTRANS_IDLE ) ) {
+         return false;
+      }
+      // an empty query is the cheapest round-trip to the server
+      const std::unique_ptr< PGresult, decltype( &PQclear ) > result( PQexec( pgconn, "" ), &PQclear );
+      return PQresultStatus( result.get() ) == PGRES_EMPTY_QUERY;
    }
 
-   connection_pool::connection_pool( const private_key /*unused*/, const std::string_view connection_info )
-      : m_connection_info( connection_info )
+   connection_pool::connection_pool( const private_key /*unused*/, const std::string_view connection_info, const std::size_t max_size, const std::size_t min_idle )
+      : internal::pool< pq::connection >( max_size, min_idle ),
+        m_connection_info( connection_info )
    {}
 
    auto connection_pool::create( const std::string_view connection_info ) -> std::shared_ptr< connection_pool >
@@ -20,9 +173,76 @@ namespace tao::pq
       return std::make_shared< connection_pool >( private_key(), connection_info );
    }
 
+   auto connection_pool::create( const std::string_view connection_info, const std::size_t max_size, const std::size_t min_idle ) -> std::shared_ptr< connection_pool >
+   {
+      auto nrv = std::make_shared< connection_pool >( private_key(), connection_info, max_size, min_idle );
+      nrv->fill();
+      return nrv;
+   }
+
    auto connection_pool::connection() -> std::shared_ptr< pq::connection >
    {
-      return get();
+      auto nrv = get();
+      prepare_borrowed( nrv );
+      return nrv;
+   }
+
+   auto connection_pool::connection( const std::chrono::steady_clock::duration timeout ) -> std::shared_ptr< pq::connection >
+   {
+      auto nrv = get( timeout );
+      if( !nrv ) {
+         throw std::runtime_error( "timeout while waiting for a connection" );
+      }
+      prepare_borrowed( nrv );
+      return nrv;
+   }
+
+   void connection_pool::prepare( const std::string& name, const std::string& statement )
+   {
+      pq::connection::check_prepared_name( name );
+      const auto is_pinned = [ & ] {
+         for( const auto& pinned : m_pinned_statements ) {
+            if( pinned.first == name ) {
+               if( pinned.second != statement ) {
+                  throw std::invalid_argument( "prepared statement " + name + " already pinned with a different statement" );
+               }
+               return true;
+            }
+         }
+         return false;
+      };
+      {
+         const std::lock_guard lock( m_session_mutex );
+         if( is_pinned() ) {
+            return;
+         }
+      }
+
+      // an invalid statement would otherwise fail every later checkout
+      const auto c = connection();
+      connection_pool::prepare_pinned( *c, name, statement );
+
+      const std::lock_guard lock( m_session_mutex );
+      if( is_pinned() ) {
+         return;
+      }
+      m_pinned_statements.emplace_back( name, statement );
+      ++m_pinned_generation;
+   }
+
+   auto connection_pool::reset_statement() const -> std::string
+   {
+      const std::lock_guard lock( m_session_mutex );
+      return m_reset_statement ? *m_reset_statement : std::string();
+   }
+
+   void connection_pool::set_reset_statement( const std::string& statement, const bool discards_statements )
+   {
+      auto sp = statement.empty() ? nullptr : std::make_shared< const std::string >( statement );
+      const bool discards = !statement.empty() && discards_statements;
+      const std::lock_guard lock( m_session_mutex );
+      m_reset_statement = std::move( sp );
+      m_reset_discards_statements = discards;
    }
 
 }  // namespace tao::pq
@@ -0,0 +1,39 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/cursor.hpp>
+
+namespace tao::pq
+{
+   void cursor::receive( const result& batch )
+   {
+      m_result.emplace( batch );
+      m_row = 0;
+      if( m_result->size() < m_fetch_size ) {
+         // last batch, release the subtransaction
+         m_transaction->execute( "CLOSE " + m_name );
+         m_transaction->commit();
+         m_transaction.reset();
+      }
+      else {
+         // fetch the next batch while the current one is being processed
+         m_prefetch.emplace( m_transaction->async_execute( m_fetch ) );
+      }
+   }
+
+   auto cursor::next() -> bool
+   {
+      if( ++m_row < m_result->size() ) {
+         return true;
+      }
+      if( !m_prefetch ) {
+         return false;
+      }
+      const auto batch = m_prefetch->get();
+      m_prefetch.reset();
+      receive( batch );
+      return has_row();
+   }
+
+}  // namespace tao::pq
@@ -5,9 +5,14 @@
 #include <cassert>
 #include <cctype>
 #include <cerrno>
+#include <charconv>
+#include <cmath>
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 #include <string>
+#include <system_error>
+#include <type_traits>
 
 #include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/strtox.hpp>
@@ -56,6 +61,19 @@ namespace tao::pq::internal
       [[nodiscard]] auto str_to_floating_point( const char* input ) -> T
       {
          assert( input );
+#if defined( __cpp_lib_to_chars )
+         if constexpr( !std::is_same_v< T, long double > ) {
+            // fast path: std::from_chars() is locale-independent and does not use errno,
+            // inputs it does not accept completely, errors and subnormal results are handled below
+            // so that both paths report underflow and overflow the same way
+            const char* end = input + std::strlen( input );
+            T result;
+            const auto [ ptr, ec ] = std::from_chars( input, end, result );
+            if( ( ec == std::errc() ) && ( ptr == end ) && ( std::fpclassify( result ) != FP_SUBNORMAL ) ) {
+               return result;
+            }
+         }
+#endif
          if( *input == '\0' || std::isspace( *input ) ) {
             throw std::runtime_error( failure_message< T >( input ) );
          }
@@ -0,0 +1,102 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/pipeline.hpp>
+
+#include <exception>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/exception.hpp>
+
+namespace tao::pq
+{
+   pipeline::pipeline( const std::shared_ptr< transaction >& transaction )
+      : m_previous( transaction ),
+        m_transaction( std::make_shared< internal::transaction_guard >( transaction->connection() ) )
+   {
+      m_transaction->connection()->enter_pipeline_mode();
+   }
+
+   pipeline::~pipeline()
+   {
+      if( m_transaction ) {
+         // the pipeline was not finished, e.g. during stack unwinding, so the statements since the last
+         // synchronization point are abandoned: a failing statement makes the server skip or roll them back
+         // before the final synchronization point, then the results are consumed to leave pipeline mode
+         try {
+            if( m_unsynced != 0 ) {
+               PGconn* pgconn = m_transaction->connection()->underlying_raw_ptr();
+               if( PQsendQueryParams( pgconn, "DO $$ BEGIN RAISE EXCEPTION 'pipeline abandoned'; END $$", 0, nullptr, nullptr, nullptr, nullptr, 0 ) == 0 ) {
+                  throw pq::connection_error( PQerrorMessage( pgconn ), "08000" );  // LCOV_EXCL_LINE
+               }
+               sync();
+            }
+            (void)finish();
+         }
+         // LCOV_EXCL_START
+         catch( ... ) {
+         }
+         // LCOV_EXCL_STOP
+      }
+   }
+
+   void pipeline::sync()
+   {
+      m_transaction->connection()->pipeline_sync();
+      m_unsynced = 0;
+      ++m_syncs;
+   }
+
+   auto pipeline::finish() -> std::vector< result >
+   {
+      if( m_unsynced != 0 ) {
+         sync();
+      }
+      const auto& connection = m_transaction->connection();
+      std::vector< result > nrv;
+      std::exception_ptr error;
+      while( m_syncs != 0 ) {
+         PGresult* pgresult = PQgetResult( connection->underlying_raw_ptr() );
+         if( pgresult == nullptr ) {
+            // end of the results for one statement
+            if( !connection->is_open() ) {
+               throw pq::connection_error( connection->error_message().c_str(), "08000" );  // LCOV_EXCL_LINE
+            }
+            continue;
+         }
+         switch( PQresultStatus( pgresult ) ) {
+            case PGRES_PIPELINE_SYNC:
+               PQclear( pgresult );
+               --m_syncs;
+               break;
+
+            case PGRES_PIPELINE_ABORTED:
+               // skipped due to an earlier error, which is reported instead
+               PQclear( pgresult );
+               break;
+
+            default:
+               try {
+                  nrv.emplace_back( result( pgresult ) );
+               }
+               catch( ... ) {
+                  if( !error ) {
+                     error = std::current_exception();
+                  }
+               }
+         }
+      }
+      connection->exit_pipeline_mode();
+      connection->handle_notifications();
+      m_transaction.reset();
+      m_previous.reset();
+      if( error ) {
+         std::rethrow_exception( error );
+      }
+      return nrv;
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,96 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/replicated_pool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+#include <vector>
+
+#include <tao/pq/exception.hpp>
+
+namespace tao::pq
+{
+   replicated_pool::replicated_pool( const private_key /*unused*/, std::shared_ptr< connection_pool > primary, std::vector< std::shared_ptr< connection_pool > > replicas ) noexcept
+      : m_primary( std::move( primary ) ),
+        m_replicas( std::move( replicas ) ),
+        m_failed( m_replicas.size() )
+   {}
+
+   auto replicated_pool::create( const std::string_view primary_connection_info, const std::vector< std::string >& replica_connection_infos, const std::size_t max_size, const std::size_t min_idle ) -> std::shared_ptr< replicated_pool >
+   {
+      std::vector< std::shared_ptr< connection_pool > > replicas;
+      replicas.reserve( replica_connection_infos.size() );
+      for( const auto& connection_info : replica_connection_infos ) {
+         replicas.emplace_back( connection_pool::create( connection_info, max_size, min_idle ) );
+      }
+      return std::make_shared< replicated_pool >( private_key(), connection_pool::create( primary_connection_info, max_size, min_idle ), std::move( replicas ) );
+   }
+
+   auto replicated_pool::connection() -> std::shared_ptr< pq::connection >
+   {
+      return m_primary->connection();
+   }
+
+   auto replicated_pool::replica_connection() -> std::shared_ptr< pq::connection >
+   {
+      const std::size_t n = m_replicas.size();
+      if( n == 0 ) {
+         return m_primary->connection();
+      }
+
+      // order the replicas by their load, starting at a rotating offset to spread ties,
+      // replicas that recently failed to connect are skipped until their backoff expired
+      const auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+      const auto backoff = m_backoff.load( std::memory_order_relaxed );
+      const std::size_t offset = m_next.fetch_add( 1, std::memory_order_relaxed );
+      std::vector< std::pair< std::size_t, std::size_t > > order;
+      order.reserve( n );
+      for( std::size_t i = 0; i < n; ++i ) {
+         const std::size_t index = ( offset + i ) % n;
+         const auto failed = m_failed[ index ].load( std::memory_order_relaxed );
+         if( ( failed == 0 ) || ( now - failed >= backoff ) ) {
+            order.emplace_back( m_replicas[ index ]->in_use(), index );
+         }
+      }
+      if( order.empty() ) {
+         throw pq::connection_error( "all replicas failed recently", "08000" );
+      }
+      std::stable_sort( order.begin(), order.end(), []( const auto& lhs, const auto& rhs ) { return lhs.first < rhs.first; } );
+
+      // when a replica is not reachable, try the next one
+      std::exception_ptr error;
+      for( const auto& entry : order ) {
+         auto& failed = m_failed[ entry.second ];
+         try {
+            auto nrv = m_replicas[ entry.second ]->connection();
+            if( failed.load( std::memory_order_relaxed ) != 0 ) {
+               failed.store( 0, std::memory_order_relaxed );
+            }
+            return nrv;
+         }
+         catch( const std::exception& ) {
+            failed.store( std::max< std::chrono::steady_clock::rep >( std::chrono::steady_clock::now().time_since_epoch().count(), 1 ), std::memory_order_relaxed );
+            error = std::current_exception();
+         }
+      }
+      std::rethrow_exception( error );
+   }
+
+   auto replicated_pool::transaction( const access_mode am, const isolation_level il ) -> std::shared_ptr< pq::transaction >
+   {
+      if( am == access_mode::read_only ) {
+         return replica_connection()->transaction( am, il );
+      }
+      return connection()->transaction( am, il );
+   }
+
+   auto replicated_pool::transaction( const isolation_level il, const access_mode am ) -> std::shared_ptr< pq::transaction >
+   {
+      return transaction( am, il );
+   }
+
+}  // namespace tao::pq
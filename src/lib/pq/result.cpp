@@ -2,10 +2,13 @@
 // Distributed under the Boost Software License, Version 1.0.
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
+#include <algorithm>
 #include <cassert>
 #include <charconv>
 #include <cstring>
+#include <mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <libpq-fe.h>
 
@@ -17,6 +20,68 @@
 
 namespace tao::pq
 {
+   namespace internal
+   {
+      // owns the PGresult, shared by all copies of a result, the column index is built on the first lookup
+      class result_state
+      {
+      private:
+         PGresult* const m_pgresult;
+         std::once_flag m_once;
+         std::unordered_map< std::string_view, std::size_t > m_columns;
+
+      public:
+         explicit result_state( PGresult* pgresult ) noexcept
+            : m_pgresult( pgresult )
+         {}
+
+         result_state( const result_state& ) = delete;
+         result_state( result_state&& ) = delete;
+         void operator=( const result_state& ) = delete;
+         void operator=( result_state&& ) = delete;
+
+         ~result_state()
+         {
+            PQclear( m_pgresult );
+         }
+
+         [[nodiscard]] auto pgresult() const noexcept -> PGresult*
+         {
+            return m_pgresult;
+         }
+
+         [[nodiscard]] static auto create( PGresult* pgresult ) -> std::shared_ptr< result_state >
+         {
+            try {
+               return std::make_shared< result_state >( pgresult );
+            }
+            // LCOV_EXCL_START
+            catch( ... ) {
+               PQclear( pgresult );
+               throw;
+            }
+            // LCOV_EXCL_STOP
+         }
+
+         [[nodiscard]] auto find( const std::size_t columns, const std::string_view in_name ) -> std::optional< std::size_t >
+         {
+            std::call_once( m_once, [ & ] {
+               m_columns.reserve( columns );
+               for( std::size_t column = 0; column < columns; ++column ) {
+                  // the names are owned by the PGresult, for duplicate names the first column wins
+                  m_columns.try_emplace( PQfname( m_pgresult, static_cast< int >( column ) ), column );
+               }
+            } );
+            const auto it = m_columns.find( in_name );
+            if( it == m_columns.end() ) {
+               return std::nullopt;
+            }
+            return it->second;
+         }
+      };
+
+   }  // namespace internal
+
    void result::check_has_result_set() const
    {
       if( m_columns == 0 ) {
@@ -35,15 +100,28 @@ namespace tao::pq
       }
    }
 
-   result::result( PGresult* pgresult, const mode_t mode )
-      : m_pgresult( pgresult, &PQclear ),
-        m_columns( PQnfields( pgresult ) ),
-        m_rows( PQntuples( pgresult ) )
+   void result::check_column( const std::size_t column ) const
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
+      }
+   }
+
+   result::result( const std::shared_ptr< internal::result_state >& state, const mode_t mode )
+      : m_pgresult( state, state->pgresult() ),
+        m_columns( PQnfields( m_pgresult.get() ) ),
+        m_rows( PQntuples( m_pgresult.get() ) ),
+        m_state( state.get() )
    {
+      PGresult* pgresult = m_pgresult.get();
       const auto status = PQresultStatus( pgresult );
       switch( status ) {
          case PGRES_COMMAND_OK:
          case PGRES_TUPLES_OK:
+         case PGRES_SINGLE_TUPLE:
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+         case PGRES_TUPLES_CHUNK:
+#endif
             if( mode == mode_t::expect_ok ) {
                return;
             }
@@ -72,6 +150,10 @@ namespace tao::pq
       throw std::runtime_error( "unexpected result: " + res_status );
    }
 
+   result::result( PGresult* pgresult, const mode_t mode )
+      : result( internal::result_state::create( pgresult ), mode )
+   {}
+
    auto result::has_rows_affected() const noexcept -> bool
    {
       const char* str = PQcmdTuples( m_pgresult.get() );
@@ -95,15 +177,51 @@ namespace tao::pq
       return PQfname( m_pgresult.get(), static_cast< int >( column ) );
    }
 
+   auto result::find( const std::string_view in_name ) const -> std::optional< std::size_t >
+   {
+      if( m_columns == 0 ) {
+         return std::nullopt;
+      }
+      return m_state->find( m_columns, in_name );
+   }
+
    auto result::index( const internal::zsv in_name ) const -> std::size_t
    {
-      const int column = PQfnumber( m_pgresult.get(), in_name );
-      if( column < 0 ) {
-         assert( column == -1 );
+      const std::string_view sv = in_name;
+      // names without quotes or upper case characters are used as-is, just like PQfnumber() does
+      const bool verbatim = std::none_of( sv.begin(), sv.end(), []( const char c ) { return ( c == '"' ) || ( ( c >= 'A' ) && ( c <= 'Z' ) ); } );
+      const auto column = verbatim ? find( sv ) : find( column_ref( sv ).name() );
+      if( !column ) {
          check_has_result_set();
-         throw std::out_of_range( "column not found: " + std::string( in_name ) );
+         throw std::out_of_range( "column not found: " + std::string( sv ) );
       }
-      return column;
+      return *column;
+   }
+
+   auto result::index( const column_ref& in_name ) const -> std::size_t
+   {
+      const auto column = find( in_name.name() );
+      if( !column ) {
+         check_has_result_set();
+         throw std::out_of_range( "column not found: " + in_name.name() );
+      }
+      return *column;
+   }
+
+   auto result::type( const std::size_t column ) const -> oid
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
+      }
+      return static_cast< oid >( PQftype( m_pgresult.get(), static_cast< int >( column ) ) );
+   }
+
+   auto result::is_binary( const std::size_t column ) const -> bool
+   {
+      if( column >= m_columns ) {
+         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
+      }
+      return PQfformat( m_pgresult.get(), static_cast< int >( column ) ) == 1;
    }
 
    auto result::empty() const -> bool
@@ -145,6 +263,27 @@ namespace tao::pq
       return PQgetvalue( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
    }
 
+   auto result::length( const std::size_t row, const std::size_t column ) const -> std::size_t
+   {
+      check_row( row );
+      if( column >= m_columns ) {
+         throw std::out_of_range( internal::printf( "column %zu out of range (0-%zu)", column, m_columns - 1 ) );
+      }
+      return PQgetlength( m_pgresult.get(), static_cast< int >( row ), static_cast< int >( column ) );
+   }
+
+   auto result::null_bitmap( const std::size_t column ) const -> std::vector< bool >
+   {
+      check_has_result_set();
+      check_column( column );
+      std::vector< bool > nrv( m_rows );
+      const int c = static_cast< int >( column );
+      for( std::size_t row = 0; row < m_rows; ++row ) {
+         nrv[ row ] = PQgetisnull( m_pgresult.get(), static_cast< int >( row ), c ) != 0;
+      }
+      return nrv;
+   }
+
    auto result::at( const std::size_t row ) const -> pq::row
    {
       check_row( row );
@@ -4,11 +4,17 @@
 
 #include <tao/pq/result_traits.hpp>
 
+#include <cstdint>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
+#include <tao/pq/internal/demangle.hpp>
+#include <tao/pq/internal/endian.hpp>
 #include <tao/pq/internal/from_chars.hpp>
+#include <tao/pq/internal/printf.hpp>
 #include <tao/pq/internal/resize_uninitialized.hpp>
 #include <tao/pq/internal/strtox.hpp>
 
@@ -50,8 +56,104 @@ namespace tao::pq
          return nrv;
       }
 
+      template< typename T >
+      [[noreturn]] void throw_invalid_binary( const std::size_t size, const oid type )
+      {
+         const auto name = internal::demangle< T >();
+         throw std::runtime_error( internal::printf( "invalid binary value in tao::pq::result_traits<%.*s> for type oid %u with size %zu", static_cast< int >( name.size() ), name.data(), static_cast< unsigned >( type ), size ) );
+      }
+
+      // the binary format of these types is the text itself
+      [[nodiscard]] auto is_text( const oid type ) noexcept -> bool
+      {
+         switch( type ) {
+            case oid::text:
+            case oid::varchar:
+            case oid::bpchar:
+            case oid::name:
+            case oid::unknown:
+               return true;
+
+            default:
+               return false;
+         }
+      }
+
+      template< typename T >
+      void check_text_binary( const std::size_t size, const oid type )
+      {
+         if( !is_text( type ) ) {
+            throw_invalid_binary< T >( size, type );
+         }
+      }
+
+      template< typename T >
+      [[nodiscard]] auto integer_from_binary( const char* value, const std::size_t size, const oid type ) -> T
+      {
+         std::int64_t v;
+         if( ( type == oid::int2 ) && ( size == 2 ) ) {
+            v = internal::load_be< std::int16_t >( value );
+         }
+         else if( ( type == oid::int4 ) && ( size == 4 ) ) {
+            v = internal::load_be< std::int32_t >( value );
+         }
+         else if( ( type == oid::int8 ) && ( size == 8 ) ) {
+            v = internal::load_be< std::int64_t >( value );
+         }
+         else {
+            throw_invalid_binary< T >( size, type );
+         }
+         if constexpr( std::is_signed_v< T > ) {
+            if( ( v < static_cast< std::int64_t >( std::numeric_limits< T >::min() ) ) || ( v > static_cast< std::int64_t >( std::numeric_limits< T >::max() ) ) ) {
+               throw std::out_of_range( internal::printf( "value %lld out of range", static_cast< long long >( v ) ) );
+            }
+         }
+         else {
+            if( ( v < 0 ) || ( static_cast< std::uint64_t >( v ) > std::numeric_limits< T >::max() ) ) {
+               throw std::out_of_range( internal::printf( "value %lld out of range", static_cast< long long >( v ) ) );
+            }
+         }
+         return static_cast< T >( v );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto float_from_binary( const char* value, const std::size_t size, const oid type ) -> T
+      {
+         if( ( type == oid::float4 ) && ( size == 4 ) ) {
+            return static_cast< T >( internal::load_be< float >( value ) );
+         }
+         if( ( type == oid::float8 ) && ( size == 8 ) ) {
+            return static_cast< T >( internal::load_be< double >( value ) );
+         }
+         throw_invalid_binary< T >( size, type );
+      }
+
+      template< typename T >
+      [[nodiscard]] auto bytes_from_binary( const char* value, const std::size_t size, const oid type ) -> T
+      {
+         if( type != oid::bytea ) {
+            throw_invalid_binary< T >( size, type );
+         }
+         T nrv;
+         internal::resize_uninitialized( nrv, size );
+         std::memcpy( nrv.data(), value, size );
+         return nrv;
+      }
+
    }  // namespace
 
+   auto result_traits< const char* >::from_binary( const char* value, const std::size_t size, const oid type ) -> const char*
+   {
+      check_text_binary< const char* >( size, type );
+      return value;
+   }
+
+   auto result_traits< std::string_view >::from_binary( const char* value, const std::size_t size, const oid type ) -> std::string_view
+   {
+      check_text_binary< std::string_view >( size, type );
+      return { value, size };
+   }
+
    auto result_traits< bool >::from( const char* value ) -> bool
    {
       if( ( value[ 0 ] != '\0' ) && ( value[ 1 ] == '\0' ) ) {
@@ -65,6 +167,14 @@ namespace tao::pq
       throw std::runtime_error( "invalid value in tao::pq::result_traits<bool> for input: " + std::string( value ) );
    }
 
+   auto result_traits< bool >::from_binary( const char* value, const std::size_t size, const oid type ) -> bool
+   {
+      if( ( type != oid::bool_ ) || ( size != 1 ) ) {
+         throw_invalid_binary< bool >( size, type );
+      }
+      return value[ 0 ] != 0;
+   }
+
    auto result_traits< char >::from( const char* value ) -> char
    {
       if( ( value[ 0 ] == '\0' ) || ( value[ 1 ] != '\0' ) ) {
@@ -73,79 +183,168 @@ namespace tao::pq
       return value[ 0 ];
    }
 
+   auto result_traits< char >::from_binary( const char* value, const std::size_t size, const oid type ) -> char
+   {
+      if( ( size != 1 ) || !( ( type == oid::char_ ) || is_text( type ) ) ) {
+         throw_invalid_binary< char >( size, type );
+      }
+      return value[ 0 ];
+   }
+
    auto result_traits< signed char >::from( const char* value ) -> signed char
    {
       return internal::from_chars< signed char >( value );
    }
 
+   auto result_traits< signed char >::from_binary( const char* value, const std::size_t size, const oid type ) -> signed char
+   {
+      return integer_from_binary< signed char >( value, size, type );
+   }
+
    auto result_traits< unsigned char >::from( const char* value ) -> unsigned char
    {
       return internal::from_chars< unsigned char >( value );
    }
 
+   auto result_traits< unsigned char >::from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned char
+   {
+      return integer_from_binary< unsigned char >( value, size, type );
+   }
+
    auto result_traits< short >::from( const char* value ) -> short
    {
       return internal::from_chars< short >( value );
    }
 
+   auto result_traits< short >::from_binary( const char* value, const std::size_t size, const oid type ) -> short
+   {
+      return integer_from_binary< short >( value, size, type );
+   }
+
    auto result_traits< unsigned short >::from( const char* value ) -> unsigned short
    {
       return internal::from_chars< unsigned short >( value );
    }
 
+   auto result_traits< unsigned short >::from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned short
+   {
+      return integer_from_binary< unsigned short >( value, size, type );
+   }
+
    auto result_traits< int >::from( const char* value ) -> int
    {
       return internal::from_chars< int >( value );
    }
 
+   auto result_traits< int >::from_binary( const char* value, const std::size_t size, const oid type ) -> int
+   {
+      return integer_from_binary< int >( value, size, type );
+   }
+
    auto result_traits< unsigned >::from( const char* value ) -> unsigned
    {
       return internal::from_chars< unsigned >( value );
    }
 
+   auto result_traits< unsigned >::from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned
+   {
+      return integer_from_binary< unsigned >( value, size, type );
+   }
+
    auto result_traits< long >::from( const char* value ) -> long
    {
       return internal::from_chars< long >( value );
    }
 
+   auto result_traits< long >::from_binary( const char* value, const std::size_t size, const oid type ) -> long
+   {
+      return integer_from_binary< long >( value, size, type );
+   }
+
    auto result_traits< unsigned long >::from( const char* value ) -> unsigned long
    {
       return internal::from_chars< unsigned long >( value );
    }
 
+   auto result_traits< unsigned long >::from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned long
+   {
+      return integer_from_binary< unsigned long >( value, size, type );
+   }
+
    auto result_traits< long long >::from( const char* value ) -> long long
    {
       return internal::from_chars< long long >( value );
    }
 
+   auto result_traits< long long >::from_binary( const char* value, const std::size_t size, const oid type ) -> long long
+   {
+      return integer_from_binary< long long >( value, size, type );
+   }
+
    auto result_traits< unsigned long long >::from( const char* value ) -> unsigned long long
    {
       return internal::from_chars< unsigned long long >( value );
    }
 
+   auto result_traits< unsigned long long >::from_binary( const char* value, const std::size_t size, const oid type ) -> unsigned long long
+   {
+      return integer_from_binary< unsigned long long >( value, size, type );
+   }
+
    auto result_traits< float >::from( const char* value ) -> float
    {
       return internal::strtof( value );
    }
 
+   auto result_traits< float >::from_binary( const char* value, const std::size_t size, const oid type ) -> float
+   {
+      return float_from_binary< float >( value, size, type );
+   }
+
    auto result_traits< double >::from( const char* value ) -> double
    {
       return internal::strtod( value );
    }
 
+   auto result_traits< double >::from_binary( const char* value, const std::size_t size, const oid type ) -> double
+   {
+      return float_from_binary< double >( value, size, type );
+   }
+
    auto result_traits< long double >::from( const char* value ) -> long double
    {
       return internal::strtold( value );
    }
 
+   auto result_traits< long double >::from_binary( const char* value, const std::size_t size, const oid type ) -> long double
+   {
+      return float_from_binary< long double >( value, size, type );
+   }
+
+   auto result_traits< std::string >::from_binary( const char* value, const std::size_t size, const oid type ) -> std::string
+   {
+      check_text_binary< std::string >( size, type );
+      return { value, size };
+   }
+
    auto result_traits< std::basic_string< unsigned char > >::from( const char* value ) -> std::basic_string< unsigned char >
    {
       return unescape_bytea< std::basic_string< unsigned char > >( value );
    }
 
+   auto result_traits< std::basic_string< unsigned char > >::from_binary( const char* value, const std::size_t size, const oid type ) -> std::basic_string< unsigned char >
+   {
+      return bytes_from_binary< std::basic_string< unsigned char > >( value, size, type );
+   }
+
    auto result_traits< binary >::from( const char* value ) -> binary
    {
       return unescape_bytea< binary >( value );
    }
 
+   auto result_traits< binary >::from_binary( const char* value, const std::size_t size, const oid type ) -> binary
+   {
+      return bytes_from_binary< binary >( value, size, type );
+   }
+
 }  // namespace tao::pq
@@ -7,6 +7,8 @@
 
 #include <cassert>
 
+#include <libpq-fe.h>
+
 namespace tao::pq
 {
    void row::ensure_column( const std::size_t column ) const
@@ -16,6 +18,41 @@ namespace tao::pq
       }
    }
 
+   void row::ensure_field( const std::size_t column ) const
+   {
+      ensure_column( column );
+      assert( m_result );
+      m_result->check_row( m_row );
+   }
+
+   void row::throw_unexpected_null( const std::size_t column ) const
+   {
+      throw std::runtime_error( internal::printf( "unexpected NULL value in row %zu column %zu = %s", m_row, m_offset + column, name( column ).c_str() ) );
+   }
+
+   void row::throw_binary_not_supported( const std::string_view type ) const
+   {
+      throw std::runtime_error( internal::printf( "binary format not supported by tao::pq::result_traits<%.*s>", static_cast< int >( type.size() ), type.data() ) );
+   }
+
+   auto row::is_binary_unchecked( const std::size_t column ) const noexcept -> bool
+   {
+      assert( m_result );
+      return PQfformat( m_result->underlying_raw_ptr(), static_cast< int >( m_offset + column ) ) == 1;
+   }
+
+   auto row::type_unchecked( const std::size_t column ) const noexcept -> oid
+   {
+      assert( m_result );
+      return static_cast< oid >( PQftype( m_result->underlying_raw_ptr(), static_cast< int >( m_offset + column ) ) );
+   }
+
+   auto row::length_unchecked( const std::size_t column ) const noexcept -> std::size_t
+   {
+      assert( m_result );
+      return PQgetlength( m_result->underlying_raw_ptr(), static_cast< int >( m_row ), static_cast< int >( m_offset + column ) );
+   }
+
    auto row::slice( const std::size_t offset, const std::size_t in_columns ) const -> row
    {
       assert( m_result );
@@ -37,7 +74,18 @@ namespace tao::pq
    auto row::index( const internal::zsv in_name ) const -> std::size_t
    {
       assert( m_result );
-      const std::size_t n = m_result->index( in_name );
+      return slice_index( m_result->index( in_name ), in_name );
+   }
+
+   auto row::index( const column_ref& in_name ) const -> std::size_t
+   {
+      assert( m_result );
+      return slice_index( m_result->index( in_name ), in_name.name() );
+   }
+
+   auto row::slice_index( const std::size_t n, const std::string_view in_name ) const -> std::size_t
+   {
+      assert( m_result );
       if( n >= m_offset ) {
          if( n - m_offset < m_columns ) {
             return n - m_offset;
@@ -78,6 +126,39 @@ namespace tao::pq
       return m_result->get( m_row, m_offset + column );
    }
 
+   auto row::is_null_unchecked( const std::size_t column ) const noexcept -> bool
+   {
+      assert( m_result );
+      return PQgetisnull( m_result->underlying_raw_ptr(), static_cast< int >( m_row ), static_cast< int >( m_offset + column ) ) != 0;
+   }
+
+   auto row::get_unchecked( const std::size_t column ) const noexcept -> const char*
+   {
+      assert( m_result );
+      return PQgetvalue( m_result->underlying_raw_ptr(), static_cast< int >( m_row ), static_cast< int >( m_offset + column ) );
+   }
+
+   auto row::type( const std::size_t column ) const -> oid
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->type( m_offset + column );
+   }
+
+   auto row::is_binary( const std::size_t column ) const -> bool
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->is_binary( m_offset + column );
+   }
+
+   auto row::length( const std::size_t column ) const -> std::size_t
+   {
+      ensure_column( column );
+      assert( m_result );
+      return m_result->length( m_row, m_offset + column );
+   }
+
    auto row::at( const std::size_t column ) const -> field
    {
       ensure_column( column );
@@ -0,0 +1,106 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/row_stream.hpp>
+
+#include <stdexcept>
+
+#include <libpq-fe.h>
+
+#include <tao/pq/connection.hpp>
+#include <tao/pq/exception.hpp>
+
+namespace tao::pq
+{
+   namespace
+   {
+      void drain( PGconn* pgconn ) noexcept
+      {
+         while( PGresult* pgresult = PQgetResult( pgconn ) ) {
+            PQclear( pgresult );
+         }
+      }
+
+   }  // namespace
+
+   row_stream::~row_stream()
+   {
+      cancel();
+   }
+
+   auto row_stream::is_autocommit( const transaction& tr ) noexcept -> bool
+   {
+      return PQtransactionStatus( tr.connection()->underlying_raw_ptr() ) == PQTRANS_IDLE;
+   }
+
+   void row_stream::cancel() noexcept
+   {
+      if( m_transaction ) {
+         PGconn* pgconn = m_transaction->connection()->underlying_raw_ptr();
+         if( m_autocommit ) {
+            // we don't want to receive all remaining rows, so we cancel
+            // the statement and discard the results received so far
+            if( PGcancel* pgcancel = PQgetCancel( pgconn ) ) {
+               char buffer[ 256 ];
+               (void)PQcancel( pgcancel, buffer, sizeof( buffer ) );
+               PQfreeCancel( pgcancel );
+            }
+         }
+         // inside a transaction block, cancelling would abort the transaction,
+         // so the remaining rows are received and discarded
+         drain( pgconn );
+      }
+   }
+
+   void row_stream::set_mode( const std::size_t chunk_size )
+   {
+      PGconn* pgconn = m_transaction->connection()->underlying_raw_ptr();
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+      if( chunk_size > 1 ) {
+         if( PQsetChunkedRowsMode( pgconn, static_cast< int >( chunk_size ) ) == 0 ) {
+            throw std::runtime_error( "PQsetChunkedRowsMode() failed" );  // LCOV_EXCL_LINE
+         }
+         return;
+      }
+#else
+      (void)chunk_size;
+#endif
+      if( PQsetSingleRowMode( pgconn ) == 0 ) {
+         throw std::runtime_error( "PQsetSingleRowMode() failed" );  // LCOV_EXCL_LINE
+      }
+   }
+
+   auto row_stream::fetch() -> bool
+   {
+      const auto& connection = m_transaction->connection();
+      PGconn* pgconn = connection->underlying_raw_ptr();
+      PGresult* pgresult = PQgetResult( pgconn );
+      if( pgresult == nullptr ) {
+         throw pq::connection_error( connection->error_message().c_str(), "08000" );  // LCOV_EXCL_LINE
+      }
+      m_row = 0;
+      switch( PQresultStatus( pgresult ) ) {
+         case PGRES_SINGLE_TUPLE:
+#if defined( LIBPQ_HAS_CHUNK_MODE )
+         case PGRES_TUPLES_CHUNK:
+#endif
+            m_result.emplace( result( pgresult ) );
+            return true;
+
+         default:
+            break;
+      }
+
+      // the final result has no rows, it signals success or failure
+      const auto keep = connection;
+      m_result.reset();
+      m_transaction.reset();
+      m_previous.reset();
+      drain( pgconn );
+      m_result.emplace( result( pgresult ) );
+      keep->handle_notifications();
+      return false;
+   }
+
+}  // namespace tao::pq
@@ -0,0 +1,54 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <tao/pq/sharded_pool.hpp>
+
+#include <stdexcept>
+#include <utility>
+
+#include <tao/pq/internal/hash_ring.hpp>
+#include <tao/pq/internal/printf.hpp>
+
+namespace tao::pq
+{
+   sharded_pool::sharded_pool( const private_key /*unused*/, std::vector< std::shared_ptr< connection_pool > > shards, router r )
+      : m_shards( std::move( shards ) ),
+        m_router( std::move( r ) )
+   {
+      if( m_shards.empty() ) {
+         throw std::invalid_argument( "sharded pool requires at least one shard" );
+      }
+      if( !m_router ) {
+         throw std::invalid_argument( "sharded pool requires a router" );
+      }
+   }
+
+   auto sharded_pool::create( const std::vector< std::string >& connection_infos, const std::size_t max_size, const std::size_t min_idle ) -> std::shared_ptr< sharded_pool >
+   {
+      if( connection_infos.empty() ) {
+         throw std::invalid_argument( "sharded pool requires at least one shard" );
+      }
+      return sharded_pool::create( connection_infos, internal::hash_ring( connection_infos.size() ), max_size, min_idle );
+   }
+
+   auto sharded_pool::create( const std::vector< std::string >& connection_infos, router r, const std::size_t max_size, const std::size_t min_idle ) -> std::shared_ptr< sharded_pool >
+   {
+      std::vector< std::shared_ptr< connection_pool > > shards;
+      shards.reserve( connection_infos.size() );
+      for( const auto& connection_info : connection_infos ) {
+         shards.emplace_back( connection_pool::create( connection_info, max_size, min_idle ) );
+      }
+      return std::make_shared< sharded_pool >( private_key(), std::move( shards ), std::move( r ) );
+   }
+
+   auto sharded_pool::shard( const std::string_view key ) const -> std::size_t
+   {
+      const std::size_t index = m_router( key );
+      if( index >= m_shards.size() ) {
+         throw std::out_of_range( internal::printf( "router returned invalid shard %zu, only %zu shards available", index, m_shards.size() ) );
+      }
+      return index;
+   }
+
+}  // namespace tao::pq
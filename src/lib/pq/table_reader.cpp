@@ -15,23 +15,26 @@
 
 namespace tao::pq
 {
-   auto table_reader::get_raw_data() -> std::string_view
+   auto table_reader::get_copy_data( const bool async ) -> std::optional< std::string_view >
    {
       char* buffer = nullptr;
-      const auto result = PQgetCopyData( m_transaction->connection()->underlying_raw_ptr(), &buffer, 0 );
+      const auto result = PQgetCopyData( m_transaction->connection()->underlying_raw_ptr(), &buffer, async ? 1 : 0 );
       m_buffer.reset( buffer );
       if( result > 0 ) {
-         return { static_cast< const char* >( buffer ), static_cast< std::size_t >( result ) };
+         return std::string_view( static_cast< const char* >( buffer ), static_cast< std::size_t >( result ) );
       }
       switch( result ) {
-         case 0:                 // LCOV_EXCL_LINE
+         case 0:
+            if( async ) {
+               return std::nullopt;
+            }
             TAO_PQ_UNREACHABLE;  // LCOV_EXCL_LINE
          case -1: {
             (void)pq::result( PQgetResult( m_transaction->connection()->underlying_raw_ptr() ) );
             m_transaction->connection()->handle_notifications();
             m_transaction.reset();
             m_previous.reset();
-            return {};
+            return std::string_view();
          }
          case -2:
             throw std::runtime_error( "PQgetCopyData() failed: " + m_transaction->connection()->error_message() );
@@ -39,6 +42,17 @@ namespace tao::pq
       TAO_PQ_UNREACHABLE;  // LCOV_EXCL_LINE
    }
 
+   auto table_reader::get_raw_data() -> std::string_view
+   {
+      return *get_copy_data( false );
+   }
+
+   auto table_reader::try_get_raw_data() -> std::optional< std::string_view >
+   {
+      m_transaction->connection()->consume_input();
+      return get_copy_data( true );
+   }
+
    auto table_reader::parse_data() noexcept -> bool
    {
       m_data.clear();
@@ -14,7 +14,7 @@ namespace tao::pq
 {
    table_writer::~table_writer()
    {
-      if( m_transaction ) {
+      if( m_transaction && !m_end_sent ) {
          PQputCopyEnd( m_transaction->connection()->underlying_raw_ptr(), "cancelled in dtor" );
       }
    }
@@ -27,12 +27,8 @@ namespace tao::pq
       }
    }
 
-   auto table_writer::commit() -> std::size_t
+   auto table_writer::finish() -> std::size_t
    {
-      const int r = PQputCopyEnd( m_transaction->connection()->underlying_raw_ptr(), nullptr );
-      if( r != 1 ) {
-         throw std::runtime_error( "PQputCopyEnd() failed: " + m_transaction->connection()->error_message() );
-      }
       const auto rows_affected = result( PQgetResult( m_transaction->connection()->underlying_raw_ptr() ) ).rows_affected();
       m_transaction->connection()->handle_notifications();
       m_transaction.reset();
@@ -40,4 +36,40 @@ namespace tao::pq
       return rows_affected;
    }
 
+   auto table_writer::commit() -> std::size_t
+   {
+      if( !m_end_sent ) {
+         const int r = PQputCopyEnd( m_transaction->connection()->underlying_raw_ptr(), nullptr );
+         if( r != 1 ) {
+            throw std::runtime_error( "PQputCopyEnd() failed: " + m_transaction->connection()->error_message() );
+         }
+         m_end_sent = true;
+      }
+      return finish();
+   }
+
+   auto table_writer::try_commit() -> std::optional< std::size_t >
+   {
+      const auto& connection = m_transaction->connection();
+      if( !m_end_sent ) {
+         switch( PQputCopyEnd( connection->underlying_raw_ptr(), nullptr ) ) {
+            case 1:
+               m_end_sent = true;
+               break;
+            case 0:
+               return std::nullopt;  // LCOV_EXCL_LINE
+            default:
+               throw std::runtime_error( "PQputCopyEnd() failed: " + connection->error_message() );
+         }
+      }
+      if( !connection->flush() ) {
+         return std::nullopt;  // LCOV_EXCL_LINE
+      }
+      connection->consume_input();
+      if( connection->is_busy() ) {
+         return std::nullopt;
+      }
+      return finish();
+   }
+
 }  // namespace tao::pq
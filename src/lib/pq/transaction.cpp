@@ -137,6 +137,28 @@ namespace tao::pq
       return m_connection->execute_params( mode, statement, n_params, types, values, lengths, formats );
    }
 
+   auto transaction::execute_prepared( const result::mode_t mode,
+                                       const char* name,
+                                       const int n_params,
+                                       const char* const values[],
+                                       const int lengths[],
+                                       const int formats[] ) -> result
+   {
+      check_current_transaction();
+      return m_connection->execute_prepared( mode, name, n_params, values, lengths, formats );
+   }
+
+   void transaction::send_params( const char* statement,
+                                  const int n_params,
+                                  const Oid types[],
+                                  const char* const values[],
+                                  const int lengths[],
+                                  const int formats[] )
+   {
+      check_current_transaction();
+      m_connection->send_params( statement, n_params, types, values, lengths, formats );
+   }
+
    auto transaction::subtransaction() -> std::shared_ptr< transaction >
    {
       check_current_transaction();
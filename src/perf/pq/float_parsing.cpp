@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tao/pq/internal/strtox.hpp>
+
+// compares tao::pq::internal::strtof()/strtod(), which are used to
+// parse floating point values from results, with plain std::strtod()
+
+namespace
+{
+   template< typename F >
+   auto measure( const std::vector< std::string >& inputs, const F& f ) -> double
+   {
+      double sum = 0;
+      const auto begin = std::chrono::steady_clock::now();
+      for( int i = 0; i < 20; ++i ) {
+         for( const auto& input : inputs ) {
+            sum += static_cast< double >( f( input.c_str() ) );
+         }
+      }
+      const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - begin;
+      if( sum == 42 ) {
+         std::cout << "";  // prevents the compiler from optimizing the loop away
+      }
+      return static_cast< double >( 20 * inputs.size() ) / elapsed.count();
+   }
+
+   auto make_inputs( const char* format ) -> std::vector< std::string >
+   {
+      std::mt19937_64 rng( 42 );
+      std::uniform_real_distribution< double > distribution( -1e6, 1e6 );
+      std::vector< std::string > nrv;
+      for( std::size_t i = 0; i < 100000; ++i ) {
+         char buffer[ 32 ];
+         std::snprintf( buffer, sizeof( buffer ), format, distribution( rng ) );
+         nrv.emplace_back( buffer );
+      }
+      return nrv;
+   }
+
+}  // namespace
+
+auto main() -> int
+{
+   const auto floats = make_inputs( "%.9g" );
+   const auto doubles = make_inputs( "%.17g" );
+
+   std::cout << "parses/s  std::strtof  internal::strtof  std::strtod  internal::strtod" << std::endl;
+   std::cout << static_cast< std::size_t >( measure( floats, []( const char* s ) { return std::strtof( s, nullptr ); } ) ) << "  "
+             << static_cast< std::size_t >( measure( floats, []( const char* s ) { return tao::pq::internal::strtof( s ); } ) ) << "  "
+             << static_cast< std::size_t >( measure( doubles, []( const char* s ) { return std::strtod( s, nullptr ); } ) ) << "  "
+             << static_cast< std::size_t >( measure( doubles, []( const char* s ) { return tao::pq::internal::strtod( s ); } ) ) << std::endl;
+}
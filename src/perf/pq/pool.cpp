@@ -0,0 +1,95 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <tao/pq/internal/pool.hpp>
+
+// measures the acquire/release throughput of internal::pool
+// without any database connections involved
+
+namespace
+{
+   struct item
+   {
+      std::size_t uses = 0;
+   };
+
+   class item_pool final
+      : public tao::pq::internal::pool< item >
+   {
+   private:
+      [[nodiscard]] auto v_create() const -> std::unique_ptr< item > override
+      {
+         return std::make_unique< item >();
+      }
+
+      [[nodiscard]] auto v_is_valid( item& /*unused*/ ) const noexcept -> bool override
+      {
+         return true;
+      }
+
+   public:
+      item_pool( const std::size_t max_size, const std::size_t min_idle )
+         : tao::pq::internal::pool< item >( max_size, min_idle )
+      {}
+   };
+
+   auto run( const std::size_t threads, const std::size_t max_size, const std::size_t thread_cache = 0 ) -> double
+   {
+      const auto pool = std::make_shared< item_pool >( max_size, max_size );
+      pool->set_thread_cache( thread_cache );
+      pool->fill();
+
+      std::atomic< bool > start = false;
+      std::atomic< bool > stop = false;
+      std::atomic< std::size_t > total = 0;
+
+      std::vector< std::thread > workers;
+      for( std::size_t t = 0; t < threads; ++t ) {
+         workers.emplace_back( [ & ] {
+            while( !start.load() ) {
+               std::this_thread::yield();
+            }
+            std::size_t n = 0;
+            while( !stop.load( std::memory_order_relaxed ) ) {
+               const auto sp = pool->get();
+               ++sp->uses;
+               ++n;
+            }
+            total += n;
+         } );
+      }
+
+      const auto duration = std::chrono::milliseconds( 500 );
+      const auto begin = std::chrono::steady_clock::now();
+      start = true;
+      std::this_thread::sleep_for( duration );
+      stop = true;
+      for( auto& w : workers ) {
+         w.join();
+      }
+      const std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - begin;
+      return static_cast< double >( total.load() ) / elapsed.count();
+   }
+
+}  // namespace
+
+auto main() -> int
+{
+   const std::size_t max_threads = std::max( 1U, std::thread::hardware_concurrency() );
+   std::cout << "threads  unbounded ops/s  bounded ops/s  thread cache ops/s" << std::endl;
+   for( std::size_t threads = 1; threads <= max_threads; threads *= 2 ) {
+      const auto unbounded = run( threads, 0 );
+      const auto bounded = run( threads, threads );
+      const auto cached = run( threads, threads, 1 );
+      std::cout << threads << "  " << static_cast< std::size_t >( unbounded ) << "  " << static_cast< std::size_t >( bounded ) << "  " << static_cast< std::size_t >( cached ) << std::endl;
+   }
+}
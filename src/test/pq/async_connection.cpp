@@ -0,0 +1,78 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   // overwrite the default with an environment variable if needed
+   const auto connection_info = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+
+   {
+      // a non-routable address must not block forever
+      const auto start = std::chrono::steady_clock::now();
+      TEST_THROWS( tao::pq::connection::create_async( "host=10.255.255.1 connect_timeout=1" ).get() );
+      TEST_ASSERT( std::chrono::steady_clock::now() - start < std::chrono::seconds( 10 ) );
+   }
+
+   {
+      auto c = tao::pq::connection::create_async( connection_info );
+      TEST_ASSERT( c.is_pending() );
+      TEST_ASSERT( c.socket() >= 0 );
+      const auto connection = c.get();
+      TEST_ASSERT( !c.is_pending() );
+      TEST_THROWS( c.socket() );
+      TEST_THROWS( c.get() );
+      TEST_ASSERT( connection->execute( "SELECT 1" ).as< int >() == 1 );
+   }
+
+   {
+      std::vector< tao::pq::async_connection > pending;
+      for( int i = 0; i < 4; ++i ) {
+         pending.emplace_back( tao::pq::connection::create_async( connection_info ) );
+      }
+      bool done = false;
+      while( !done ) {
+         done = true;
+         for( auto& c : pending ) {
+            if( !c.ready() ) {
+               done = false;
+            }
+         }
+      }
+      for( auto& c : pending ) {
+         TEST_ASSERT( c.ready() );
+         TEST_ASSERT( c.get()->execute( "SELECT 2" ).as< int >() == 2 );
+      }
+   }
+
+   {
+      auto c = tao::pq::connection::create_async( "dbname=DOES_NOT_EXIST" );
+      TEST_THROWS( c.get() );
+   }
+   TEST_THROWS( tao::pq::connection::create_async( "invalid connection string" ) );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,69 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   TEST_ASSERT( !connection->is_nonblocking() );
+   connection->set_nonblocking( true );
+   TEST_ASSERT( connection->is_nonblocking() );
+   TEST_ASSERT( connection->socket() >= 0 );
+
+   {
+      auto ar = connection->direct()->async_execute( "SELECT $1::INTEGER + 1, pg_sleep( 0.1 )", 41 );
+      TEST_ASSERT( ar.is_pending() );
+      TEST_ASSERT( ar.socket() == connection->socket() );
+      TEST_THROWS( connection->execute( "SELECT 42" ) );
+      while( !ar.ready() ) {
+      }
+      TEST_ASSERT( !connection->is_busy() );
+      TEST_ASSERT( ar.get()[ 0 ][ 0 ].as< int >() == 42 );
+      TEST_ASSERT( !ar.is_pending() );
+      TEST_THROWS( ar.get() );
+      TEST_THROWS( (void)ar.ready() );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      auto ar = connection->direct()->async_execute( "SELECT 1/0" );
+      auto ar2 = std::move( ar );
+      TEST_ASSERT( !ar.is_pending() );  // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+      TEST_ASSERT( ar2.is_pending() );
+      TEST_THROWS( ar2.get() );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      const auto tr = connection->transaction();
+      const auto ar = tr->async_execute( "SELECT 1" );
+      TEST_THROWS( tr->execute( "SELECT 2" ) );
+      TEST_THROWS( tr->async_execute( "SELECT 3" ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   connection->set_nonblocking( false );
+   TEST_ASSERT( !connection->is_nonblocking() );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <string>
+
+#include <tao/pq.hpp>
+
+namespace
+{
+   auto server_side( const std::shared_ptr< tao::pq::connection >& connection ) -> std::size_t
+   {
+      return connection->execute( "SELECT COUNT(*) FROM pg_prepared_statements WHERE name LIKE 'taopq auto %'" ).as< std::size_t >();
+   }
+
+}  // namespace
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   TEST_ASSERT( connection->auto_prepare_capacity() == 0 );
+   TEST_ASSERT( connection->auto_prepared_statements() == 0 );
+
+   connection->set_auto_prepare( 2, 3 );
+   TEST_ASSERT( connection->auto_prepare_threshold() == 2 );
+   TEST_ASSERT( connection->auto_prepare_capacity() == 3 );
+
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", 1 ).as< int >() == 2 );
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", 2 ).as< int >() == 3 );
+   TEST_ASSERT( connection->auto_prepared_statements() == 0 );
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", 3 ).as< int >() == 4 );
+   TEST_ASSERT( connection->auto_prepared_statements() == 1 );
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", 4 ).as< int >() == 5 );
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", "5" ).as< int >() == 6 );
+   TEST_ASSERT( connection->auto_prepared_statements() == 1 );
+
+   // the query of server_side() itself is tracked as well
+   TEST_ASSERT( server_side( connection ) == 1 );
+
+   // one-off statements do not evict prepared statements
+   for( int i = 0; i < 10; ++i ) {
+      TEST_ASSERT( connection->execute( "SELECT " + std::to_string( i ) + " AS once" ).as< int >() == i );
+   }
+   TEST_ASSERT( connection->auto_prepared_statements() == 1 );
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER + 1", 6 ).as< int >() == 7 );
+   TEST_ASSERT( server_side( connection ) == 1 );
+
+   // evicts the least recently used prepared statements
+   for( int i = 0; i < 3; ++i ) {
+      TEST_ASSERT( connection->execute( "SELECT 1" ).as< int >() == 1 );
+      TEST_ASSERT( connection->execute( "SELECT 2" ).as< int >() == 2 );
+      TEST_ASSERT( connection->execute( "SELECT 3" ).as< int >() == 3 );
+   }
+   TEST_ASSERT( connection->auto_prepared_statements() == 3 );
+   TEST_ASSERT( server_side( connection ) == 3 );
+
+   // failing executions are counted as well
+   for( int i = 0; i < 5; ++i ) {
+      TEST_THROWS( connection->execute( "SELECT 1/$1::INTEGER", 0 ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 1/$1::INTEGER", 1 ).as< int >() == 1 );
+
+   // names of explicitly prepared statements still take precedence
+   connection->prepare( "SELECT_1", "SELECT 42" );
+   TEST_ASSERT( connection->execute( "SELECT_1" ).as< int >() == 42 );
+
+   {
+      const auto tr = connection->transaction();
+      for( int i = 0; i < 5; ++i ) {
+         TEST_ASSERT( tr->execute( "SELECT $1::TEXT", "foo" ).as< std::string >() == "foo" );
+      }
+      tr->rollback();
+   }
+   TEST_ASSERT( connection->execute( "SELECT $1::TEXT", "bar" ).as< std::string >() == "bar" );
+
+   connection->set_auto_prepare( 2, 0 );
+   TEST_ASSERT( connection->auto_prepared_statements() == 0 );
+   TEST_ASSERT( server_side( connection ) == 0 );
+
+   // statements evicted in an aborted transaction are deallocated afterwards
+   connection->set_auto_prepare( 0, 1 );
+   {
+      const auto tr = connection->transaction();
+      TEST_ASSERT( tr->execute( "SELECT 10" ).as< int >() == 10 );
+      TEST_THROWS( tr->execute( "SELECT 1/0" ) );
+      TEST_THROWS( tr->execute( "SELECT 11" ) );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 12" ).as< int >() == 12 );
+   TEST_ASSERT( server_side( connection ) == 1 );
+   connection->set_auto_prepare( 0, 0 );
+   TEST_ASSERT( server_side( connection ) == 0 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
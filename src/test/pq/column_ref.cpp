@@ -0,0 +1,45 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+
+#include <tao/pq/column_ref.hpp>
+
+void run()
+{
+   TEST_ASSERT( tao::pq::column_ref( "" ).name().empty() );
+   TEST_ASSERT( tao::pq::column_ref( "a" ).name() == "a" );
+   TEST_ASSERT( tao::pq::column_ref( "A" ).name() == "a" );
+   TEST_ASSERT( tao::pq::column_ref( "customer_id" ).name() == "customer_id" );
+   TEST_ASSERT( tao::pq::column_ref( "Customer_ID" ).name() == "customer_id" );
+
+   TEST_ASSERT( tao::pq::column_ref( "\"A\"" ).name() == "A" );
+   TEST_ASSERT( tao::pq::column_ref( "\"a\"" ).name() == "a" );
+   TEST_ASSERT( tao::pq::column_ref( "\"\"" ).name().empty() );
+   TEST_ASSERT( tao::pq::column_ref( "\"a\"\"b\"" ).name() == "a\"b" );
+   TEST_ASSERT( tao::pq::column_ref( "\"Hello World\"" ).name() == "Hello World" );
+   TEST_ASSERT( tao::pq::column_ref( "Ab\"Cd\"Ef" ).name() == "abCdef" );
+   TEST_ASSERT( tao::pq::column_ref( "\"Ab" ).name() == "Ab" );
+
+   const tao::pq::column_ref ref( "\"X\"" );
+   const tao::pq::column_ref copy = ref;  // NOLINT(performance-unnecessary-copy-initialization)
+   TEST_ASSERT( copy.name() == "X" );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
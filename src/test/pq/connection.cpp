@@ -92,6 +92,15 @@ void run()
    TEST_ASSERT_MESSAGE( "checking prepared statement 'a'", connection->execute( "a" ).as< int >() == 3 );
    TEST_ASSERT_MESSAGE( "checking prepared statement 'A'", connection->execute( "A" ).as< int >() == 4 );
 
+   // names that are a prefix of a statement or of another name
+   connection->prepare( "SELECT_5", "SELECT 5" );
+   TEST_ASSERT( connection->execute( "SELECT_5" ).as< int >() == 5 );
+   TEST_ASSERT( connection->execute( "SELECT 6" ).as< int >() == 6 );
+   TEST_THROWS( connection->execute( "SELECT_55" ) );
+   TEST_THROWS( connection->execute( "SELECT_" ) );
+   connection->deallocate( "SELECT_5" );
+   TEST_THROWS( connection->execute( "SELECT_5" ) );
+
    // create a test table
    connection->execute( "CREATE TABLE tao_connection_test ( a INTEGER PRIMARY KEY, b INTEGER )" );
 
@@ -5,6 +5,9 @@
 #include "../getenv.hpp"
 #include "../macros.hpp"
 
+#include <chrono>
+#include <thread>
+
 #include <tao/pq/connection_pool.hpp>
 
 void run()
@@ -12,6 +15,13 @@ void run()
    // overwrite the default with an environment variable if needed
    const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
 
+   {
+      // prewarming with an unreachable server must fail within connect_timeout
+      const auto start = std::chrono::steady_clock::now();
+      TEST_THROWS( tao::pq::connection_pool::create( "host=10.255.255.1 connect_timeout=1", 4, 2 ) );
+      TEST_ASSERT( std::chrono::steady_clock::now() - start < std::chrono::seconds( 10 ) );
+   }
+
    const auto pool = tao::pq::connection_pool::create( connection_string );
 
    TEST_ASSERT( pool->connection() );
@@ -26,6 +36,244 @@ void run()
    TEST_ASSERT( pool2->connection()->execute( "SELECT 4" ).as< int >() == 4 );
    TEST_ASSERT( conn->execute( "SELECT 5" ).as< int >() == 5 );
    TEST_ASSERT( pool2->connection()->execute( "SELECT 6" ).as< int >() == 6 );
+
+   const auto bounded = tao::pq::connection_pool::create( connection_string, 2 );
+   TEST_ASSERT( bounded->max_size() == 2 );
+   TEST_ASSERT( bounded->size() == 0 );
+   {
+      auto c1 = bounded->connection();
+      const auto c2 = bounded->connection( std::chrono::milliseconds( 10 ) );
+      TEST_ASSERT( bounded->size() == 2 );
+      TEST_THROWS( bounded->connection( std::chrono::milliseconds( 10 ) ) );
+
+      // a returned connection wakes up a waiting thread
+      std::thread t( [ &c1 ] {
+         std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+         c1.reset();
+      } );
+      const auto c3 = bounded->connection();
+      t.join();
+      TEST_ASSERT( c3->execute( "SELECT 7" ).as< int >() == 7 );
+      TEST_ASSERT( bounded->size() == 2 );
+
+      // a detached connection no longer counts against the maximum size
+      tao::pq::connection_pool::detach( c2 );
+      TEST_ASSERT( bounded->size() == 1 );
+      TEST_ASSERT( bounded->connection( std::chrono::milliseconds( 10 ) ) );
+   }
+   TEST_ASSERT( bounded->size() == 2 );
+   TEST_ASSERT( bounded->execute( "SELECT 8" ).as< int >() == 8 );
+
+   // prewarming
+   TEST_THROWS( tao::pq::connection_pool::create( connection_string, 1, 2 ) );
+
+   const auto warm = tao::pq::connection_pool::create( connection_string, 4, 3 );
+   TEST_ASSERT( warm->min_idle() == 3 );
+   TEST_ASSERT( warm->idle() == 3 );
+   TEST_ASSERT( warm->size() == 3 );
+   {
+      const auto c1 = warm->connection();
+      const auto c2 = warm->connection();
+      const auto c3 = warm->connection();
+      TEST_ASSERT( warm->idle() == 0 );
+      const auto c4 = warm->connection();
+      TEST_ASSERT( warm->size() == 4 );
+      TEST_ASSERT( c4->execute( "SELECT 9" ).as< int >() == 9 );
+   }
+   TEST_ASSERT( warm->idle() == 4 );
+
+   const auto unbounded = tao::pq::connection_pool::create( connection_string, 0, 2 );
+   TEST_ASSERT( unbounded->idle() == 2 );
+   {
+      const auto c1 = unbounded->connection();
+      const auto c2 = unbounded->connection();
+      const auto c3 = unbounded->connection();
+      TEST_ASSERT( unbounded->idle() == 2 );
+      TEST_ASSERT( unbounded->size() == 5 );
+      TEST_ASSERT( c3->execute( "SELECT 10" ).as< int >() == 10 );
+   }
+   TEST_ASSERT( unbounded->idle() == 5 );
+
+   // statistics
+   {
+      const auto stats = unbounded->statistics();
+      TEST_ASSERT( stats.created == 5 );
+      TEST_ASSERT( stats.reused == 2 );
+      TEST_ASSERT( stats.discarded == 0 );
+      TEST_ASSERT( stats.idle == 5 );
+      TEST_ASSERT( stats.in_use == 0 );
+      TEST_ASSERT( stats.acquire.count == 3 );
+      TEST_ASSERT( stats.checkout.count == 3 );
+      TEST_ASSERT( stats.create.count == 3 );
+      TEST_ASSERT( stats.acquire.quantile( 1.0 ) == stats.acquire.max );
+   }
+
+   // maintenance
+   unbounded->set_idle_timeout( std::chrono::milliseconds( 1 ) );
+   TEST_ASSERT( unbounded->idle_timeout() == std::chrono::milliseconds( 1 ) );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+   unbounded->maintain();
+   TEST_ASSERT( unbounded->idle() == 2 );
+   TEST_ASSERT( unbounded->size() == 2 );
+   TEST_ASSERT( unbounded->statistics().discarded == 3 );
+   unbounded->set_idle_timeout( std::chrono::steady_clock::duration::zero() );
+
+   {
+      const auto c1 = unbounded->connection();
+      c1->execute( "BEGIN" );
+      unbounded->maintain();
+      TEST_ASSERT( unbounded->idle() == 2 );
+   }
+   // a connection returned inside a transaction is discarded
+   TEST_ASSERT( unbounded->idle() == 2 );
+   TEST_ASSERT( unbounded->size() == 2 );
+
+   // idle connections are probed once they were idle for a full interval
+   unbounded->maintain();
+   unbounded->maintain();
+   TEST_ASSERT( unbounded->idle() == 2 );
+   TEST_ASSERT( unbounded->size() == 2 );
+
+   unbounded->set_max_lifetime( std::chrono::milliseconds( 1 ) );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 5 ) );
+   {
+      const auto c1 = unbounded->connection();
+      TEST_ASSERT( unbounded->idle() == 2 );
+      TEST_ASSERT( c1->execute( "SELECT 11" ).as< int >() == 11 );
+   }
+   unbounded->set_max_lifetime( std::chrono::steady_clock::duration::zero() );
+
+   unbounded->start_maintenance( std::chrono::milliseconds( 10 ) );
+   unbounded->start_maintenance( std::chrono::milliseconds( 10 ) );
+   std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+   TEST_ASSERT( unbounded->idle() == 2 );
+   unbounded->stop_maintenance();
+
+   // the maintenance thread tops up the pool after a connection was opened for a caller
+   {
+      const auto background = tao::pq::connection_pool::create( connection_string, 0, 1 );
+      background->start_maintenance( std::chrono::hours( 1 ) );
+      const auto c1 = background->connection();
+      TEST_ASSERT( background->idle() == 0 );
+      const auto c2 = background->connection();
+      for( int i = 0; ( i < 500 ) && ( background->idle() == 0 ); ++i ) {
+         std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+      }
+      TEST_ASSERT( background->idle() == 1 );
+      TEST_ASSERT( background->size() == 3 );
+   }
+
+   // thread caches
+   {
+      const auto cached = tao::pq::connection_pool::create( connection_string, 1 );
+      cached->set_thread_cache( 1 );
+      TEST_ASSERT( cached->thread_cache() == 1 );
+      TEST_ASSERT( cached->execute( "SELECT 12" ).as< int >() == 12 );
+      TEST_ASSERT( cached->idle() == 1 );
+      TEST_ASSERT( cached->execute( "SELECT 13" ).as< int >() == 13 );
+      TEST_ASSERT( cached->statistics().reused == 1 );
+
+      // another thread reclaims the connection cached by this thread
+      std::thread t( [ &cached ] {
+         TEST_ASSERT( cached->connection( std::chrono::seconds( 1 ) )->execute( "SELECT 14" ).as< int >() == 14 );
+      } );
+      t.join();
+      TEST_ASSERT( cached->size() == 1 );
+      TEST_ASSERT( cached->idle() == 1 );
+      TEST_ASSERT( cached->execute( "SELECT 15" ).as< int >() == 15 );
+   }
+
+   // session state
+   {
+      const auto session = tao::pq::connection_pool::create( connection_string, 1 );
+      TEST_THROWS( session->prepare( "invalid name", "SELECT 1" ) );
+      session->prepare( "pinned", "SELECT $1::INTEGER + 1" );
+      session->prepare( "pinned", "SELECT $1::INTEGER + 1" );
+      TEST_THROWS( session->prepare( "pinned", "SELECT $1::INTEGER + 2" ) );
+      TEST_ASSERT( session->execute( "pinned", 15 ).as< int >() == 16 );
+
+      // invalid statements are rejected instead of failing every later checkout
+      TEST_THROWS( session->prepare( "broken", "THIS IS NOT SQL" ) );
+      TEST_ASSERT( session->execute( "pinned", 15 ).as< int >() == 16 );
+
+      // connections which are already idle are prepared when they are borrowed
+      session->prepare( "pinned2", "SELECT $1::INTEGER + 2" );
+      TEST_ASSERT( session->idle() == 1 );
+      TEST_ASSERT( session->execute( "pinned2", 15 ).as< int >() == 17 );
+
+      // a statement with the same name but a different text is detected
+      {
+         const auto c = session->connection();
+         c->prepare( "pinned3", "SELECT 3" );
+      }
+      TEST_THROWS( session->prepare( "pinned3", "SELECT 4" ) );
+      TEST_ASSERT( session->execute( "pinned3" ).as< int >() == 3 );
+
+      {
+         const auto c = session->connection();
+         c->set_result_format( tao::pq::result_format::binary_format );
+         c->set_notification_handler( []( const tao::pq::notification& /*unused*/ ) {} );
+         c->set_nonblocking( true );
+         c->set_auto_prepare( 1, 4 );
+         c->execute( "CREATE TEMPORARY TABLE tao_connection_pool_test ( a INTEGER )" );
+      }
+      {
+         const auto c = session->connection();
+         TEST_ASSERT( c->result_format() == tao::pq::result_format::text_format );
+         TEST_ASSERT( !c->notification_handler() );
+         TEST_ASSERT( !c->is_nonblocking() );
+         TEST_ASSERT( c->auto_prepare_threshold() == 0 );
+         TEST_ASSERT( c->auto_prepare_capacity() == 0 );
+         TEST_ASSERT( c->execute( "SELECT COUNT(*) FROM tao_connection_pool_test" ).as< int >() == 0 );
+      }
+
+      // the server-side session state is only reset when a reset statement is set
+      TEST_ASSERT( session->reset_statement().empty() );
+      session->set_reset_statement( "UNLISTEN *" );
+      session->connection()->listen( "tao_connection_pool_test" );
+      TEST_ASSERT( session->execute( "SELECT COUNT(*) FROM pg_listening_channels()" ).as< int >() == 0 );
+
+      session->set_reset_statement( "DISCARD TEMP" );
+      TEST_ASSERT( session->reset_statement() == "DISCARD TEMP" );
+      TEST_ASSERT( session->execute( "SELECT 1" ).as< int >() == 1 );
+      TEST_ASSERT( session->size() == 1 );
+      TEST_THROWS( session->execute( "SELECT COUNT(*) FROM tao_connection_pool_test" ) );
+      TEST_ASSERT( session->statistics().discarded == 0 );
+
+      // a failing reset statement discards the connection
+      session->set_reset_statement( "THIS IS NOT SQL" );
+      TEST_ASSERT( session->execute( "pinned", 1 ).as< int >() == 2 );
+      TEST_ASSERT( session->size() == 0 );
+      session->set_reset_statement( "" );
+
+      // new connections are prepared when they are opened
+      TEST_ASSERT( session->execute( "pinned2", 1 ).as< int >() == 3 );
+      TEST_ASSERT( session->reset_statement().empty() );
+
+      // statements dropped by the reset statement are prepared again
+      session->set_reset_statement( "DISCARD ALL", true );
+      {
+         const auto c = session->connection();
+         c->set_auto_prepare( 1, 4 );
+         TEST_ASSERT( c->execute( "SELECT $1::INTEGER + 3", 1 ).as< int >() == 4 );
+      }
+      TEST_ASSERT( session->execute( "pinned", 1 ).as< int >() == 2 );
+      TEST_ASSERT( session->execute( "pinned2", 1 ).as< int >() == 3 );
+      {
+         const auto c = session->connection();
+         c->set_auto_prepare( 1, 4 );
+         TEST_ASSERT( c->execute( "SELECT $1::INTEGER + 3", 1 ).as< int >() == 4 );
+         TEST_ASSERT( c->execute( "SELECT $1::INTEGER + 3", 1 ).as< int >() == 4 );
+      }
+      TEST_ASSERT( session->size() == 1 );
+      TEST_ASSERT( session->statistics().discarded == 1 );
+   }
+
+   {
+      auto background = tao::pq::connection_pool::create( connection_string, 0, 1 );
+      background->start_maintenance( std::chrono::milliseconds( 1 ) );
+      background.reset();
+   }
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
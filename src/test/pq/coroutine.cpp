@@ -0,0 +1,120 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+#include <tao/pq/coroutine.hpp>
+
+namespace
+{
+   auto query( const std::shared_ptr< tao::pq::connection > connection, const int value ) -> tao::pq::task< int >
+   {
+      const auto result = co_await connection->direct()->async_execute( "SELECT $1::INTEGER, pg_sleep( 0.1 )", value );
+      co_return result[ 0 ][ 0 ].as< int >();
+   }
+
+   auto sum( const std::shared_ptr< tao::pq::connection > connection, int& total ) -> tao::pq::task<>
+   {
+      total += co_await query( connection, 20 );
+      total += co_await query( connection, 1 );
+   }
+
+   auto copy( const std::shared_ptr< tao::pq::connection > connection ) -> tao::pq::task< std::size_t >
+   {
+      const auto tr = connection->transaction();
+      tr->execute( "DROP TABLE IF EXISTS tao_coroutine_test" );
+      tr->execute( "CREATE TABLE tao_coroutine_test ( a INTEGER NOT NULL, b TEXT NOT NULL )" );
+      {
+         tao::pq::table_writer tw( tr, "COPY tao_coroutine_test ( a, b ) FROM STDIN" );
+         for( int n = 0; n < 1000; ++n ) {
+            tw.insert( n, "EUR" );
+         }
+         TEST_ASSERT( co_await tao::pq::async_commit( tw ) == 1000 );
+      }
+      std::size_t rows = 0;
+      {
+         tao::pq::table_reader tr2( tr, "COPY tao_coroutine_test ( a, b ) TO STDOUT" );
+         while( co_await tao::pq::async_get_row( tr2 ) ) {
+            ++rows;
+         }
+      }
+      tr->commit();
+      co_return rows;
+   }
+
+   auto connect( const std::string connection_info, const int value ) -> tao::pq::task< int >
+   {
+      const auto connection = co_await tao::pq::connection::create_async( connection_info );
+      connection->set_nonblocking( true );
+      co_return co_await query( connection, value );
+   }
+
+   auto failure( const std::shared_ptr< tao::pq::connection > connection ) -> tao::pq::task<>
+   {
+      (void)co_await connection->direct()->async_execute( "SELECT 1/0" );
+   }
+
+}  // namespace
+
+void run()
+{
+   const auto connection_info = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+   const auto c1 = tao::pq::connection::create( connection_info );
+   const auto c2 = tao::pq::connection::create( connection_info );
+   c1->set_nonblocking( true );
+   c2->set_nonblocking( true );
+
+   tao::pq::event_loop loop;
+   TEST_THROWS( tao::pq::event_loop::current() );
+
+   int t1 = 0;
+   int t2 = 0;
+   loop.spawn( sum( c1, t1 ) );
+   loop.spawn( sum( c2, t2 ) );
+   loop.run();
+   TEST_ASSERT( t1 == 21 );
+   TEST_ASSERT( t2 == 21 );
+
+   TEST_ASSERT( loop.run( query( c1, 42 ) ) == 42 );
+   TEST_ASSERT( loop.run( copy( c2 ) ) == 1000 );
+   TEST_THROWS( loop.run( failure( c1 ) ) );
+   TEST_ASSERT( c1->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      // the failure is rethrown while the other task still waits for its result, the waiting task is abandoned
+      const auto c3 = tao::pq::connection::create( connection_info );
+      c3->set_nonblocking( true );
+      int t3 = 0;
+      tao::pq::event_loop loop2;
+      loop2.spawn( failure( c1 ) );
+      loop2.spawn( sum( c3, t3 ) );
+      TEST_THROWS( loop2.run() );
+      loop2.run();
+      TEST_ASSERT( t3 == 0 );
+   }
+
+   TEST_ASSERT( loop.run( connect( connection_info, 7 ) ) == 7 );
+   TEST_THROWS( loop.run( connect( "dbname=DOES_NOT_EXIST", 7 ) ) );
+
+   c2->execute( "DROP TABLE tao_coroutine_test" );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
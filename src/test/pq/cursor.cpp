@@ -0,0 +1,92 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   TEST_THROWS( tao::pq::cursor( connection->direct(), 0, "SELECT 1" ) );
+
+   {
+      tao::pq::cursor c( connection->direct(), 100, "SELECT n, n * 2 AS m FROM generate_series( 1, $1 ) AS n", 1000 );
+      TEST_ASSERT( c.fetch_size() == 100 );
+      TEST_ASSERT( c.columns() == 2 );
+      TEST_THROWS( connection->execute( "SELECT 42" ) );
+      int expected = 0;
+      for( const auto& row : c ) {
+         ++expected;
+         TEST_ASSERT( row[ 0 ].as< int >() == expected );
+         TEST_ASSERT( row[ "m" ].as< int >() == expected * 2 );
+      }
+      TEST_ASSERT( expected == 1000 );
+      TEST_ASSERT( !c.has_row() );
+      TEST_ASSERT( !c.next() );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      tao::pq::cursor c( connection->direct(), 7, "SELECT n FROM generate_series( 1, 100 ) AS n" );
+      const auto v = c.vector< int >();
+      TEST_ASSERT( v.size() == 100 );
+      TEST_ASSERT( v.front() == 1 );
+      TEST_ASSERT( v.back() == 100 );
+   }
+
+   {
+      tao::pq::cursor c( connection->direct(), 10, "SELECT n, n::TEXT FROM generate_series( 1, 10 ) AS n" );
+      const auto m = c.map< int, std::string >();
+      TEST_ASSERT( m.size() == 10 );
+      TEST_ASSERT( m.at( 10 ) == "10" );
+   }
+
+   {
+      tao::pq::cursor c( connection->direct(), 10, "SELECT n FROM generate_series( 1, 0 ) AS n" );
+      TEST_ASSERT( c.columns() == 1 );
+      TEST_ASSERT( c.begin() == c.end() );
+   }
+
+   TEST_THROWS( tao::pq::cursor( connection->direct(), 10, "SELECT 1/0" ) );
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      // destroyed before reaching the end
+      tao::pq::cursor c( connection->direct(), 10, "SELECT n FROM generate_series( 1, 10000000 ) AS n" );
+      TEST_ASSERT( c.row().as< int >() == 1 );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      const auto tr = connection->transaction();
+      tr->execute( "SELECT 1" );
+      {
+         tao::pq::cursor c( tr, 3, "SELECT n FROM generate_series( 1, 10 ) AS n" );
+         TEST_THROWS( tr->execute( "SELECT 42" ) );
+         TEST_ASSERT( c.list< int >().size() == 10 );
+      }
+      TEST_ASSERT( tr->execute( "SELECT 42" ).as< int >() == 42 );
+      tr->commit();
+   }
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -0,0 +1,66 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+
+#include <string>
+#include <vector>
+
+#include <tao/pq/internal/hash_ring.hpp>
+
+void run()
+{
+   static_assert( tao::pq::internal::fnv1a( "" ) == 0xcbf29ce484222325 );
+   static_assert( tao::pq::internal::fnv1a( "a" ) == 0xaf63dc4c8601ec8c );
+
+   TEST_THROWS( tao::pq::internal::hash_ring( 0 ) );
+   TEST_THROWS( tao::pq::internal::hash_ring( 1, 0 ) );
+
+   const tao::pq::internal::hash_ring single( 1 );
+   TEST_ASSERT( single.nodes() == 1 );
+   TEST_ASSERT( single( "" ) == 0 );
+   TEST_ASSERT( single( "tenant" ) == 0 );
+
+   const tao::pq::internal::hash_ring ring( 16 );
+   const tao::pq::internal::hash_ring grown( 17 );
+   std::vector< std::size_t > counts( 16 );
+   std::size_t moved = 0;
+   for( int i = 0; i < 16000; ++i ) {
+      const auto key = "tenant-" + std::to_string( i );
+      const auto node = ring( key );
+      TEST_ASSERT( node < 16 );
+      TEST_ASSERT( ring( key ) == node );
+      ++counts[ node ];
+
+      // adding a node only moves keys to the new node
+      const auto new_node = grown( key );
+      if( new_node != node ) {
+         TEST_ASSERT( new_node == 16 );
+         ++moved;
+      }
+   }
+   for( const auto count : counts ) {
+      TEST_ASSERT( count > 500 );
+      TEST_ASSERT( count < 1500 );
+   }
+   TEST_ASSERT( moved > 0 );
+   TEST_ASSERT( moved < 2000 );
+}
+
+auto main() -> int
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
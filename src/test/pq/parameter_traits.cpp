@@ -0,0 +1,90 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../macros.hpp"
+
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <tao/pq/parameter_traits.hpp>
+
+template< typename T >
+auto text( const T v ) -> std::string
+{
+   const tao::pq::parameter_traits< T > traits( v );
+   TEST_ASSERT( traits.template format< 0 >() == 0 );
+   return traits.template value< 0 >();
+}
+
+template< typename T >
+void check_roundtrip( const T v )
+{
+   const auto s = text( v );
+   TEST_ASSERT( s.size() < 32 );
+   TEST_ASSERT( static_cast< T >( std::strtold( s.c_str(), nullptr ) ) == v );
+
+   // arrays and COPY use the same representation
+   const tao::pq::parameter_traits< T > traits( v );
+   std::string element;
+   traits.template element< 0 >( element );
+   TEST_ASSERT( element == s );
+   std::string copy;
+   traits.template copy_to< 0 >( copy );
+   TEST_ASSERT( copy == s );
+}
+
+void run()
+{
+   TEST_ASSERT( text( std::numeric_limits< double >::quiet_NaN() ) == "NAN" );
+   TEST_ASSERT( text( std::numeric_limits< double >::infinity() ) == "INF" );
+   TEST_ASSERT( text( -std::numeric_limits< float >::infinity() ) == "-INF" );
+   TEST_ASSERT( text( -std::numeric_limits< long double >::infinity() ) == "-INF" );
+
+#if defined( __cpp_lib_to_chars )
+   // the shortest representation which round-trips
+   TEST_ASSERT( text( 0.1 ) == "0.1" );
+   TEST_ASSERT( text( 0.1F ) == "0.1" );
+   TEST_ASSERT( text( 1.5 ) == "1.5" );
+   TEST_ASSERT( text( -2.0 ) == "-2" );
+   TEST_ASSERT( text( 0.0 ) == "0" );
+   TEST_ASSERT( text( 1e100 ) == "1e+100" );
+#endif
+
+   for( const double v : { 0.0, -0.0, 0.1, 1.0 / 3.0, -1e-300, 1e300, 123456789.125 } ) {
+      check_roundtrip( v );
+      check_roundtrip( static_cast< float >( v / 1e270 ) );
+   }
+   check_roundtrip( std::numeric_limits< float >::lowest() );
+   check_roundtrip( std::numeric_limits< float >::min() );
+   check_roundtrip( std::numeric_limits< float >::max() );
+   check_roundtrip( std::numeric_limits< float >::denorm_min() );
+   check_roundtrip( std::numeric_limits< double >::lowest() );
+   check_roundtrip( std::numeric_limits< double >::min() );
+   check_roundtrip( std::numeric_limits< double >::max() );
+   check_roundtrip( std::numeric_limits< double >::denorm_min() );
+   check_roundtrip( std::numeric_limits< double >::epsilon() );
+   check_roundtrip( 1.0L / 3.0L );
+   check_roundtrip( std::numeric_limits< long double >::lowest() );
+   check_roundtrip( std::numeric_limits< long double >::max() );
+}
+
+auto main() -> int
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
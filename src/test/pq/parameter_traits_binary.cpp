@@ -0,0 +1,84 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <cstring>
+#include <limits>
+
+#include <tao/pq.hpp>
+
+template< typename T >
+void check( const T v, const tao::pq::oid oid, const char* expected, const int length )
+{
+   const tao::pq::binary_parameter< T > p( v );
+   const tao::pq::parameter_traits< tao::pq::binary_parameter< T > > traits( p );
+   TEST_ASSERT( traits.template type< 0 >() == oid );
+   TEST_ASSERT( traits.template format< 0 >() == 1 );
+   TEST_ASSERT( traits.template length< 0 >() == length );
+   TEST_ASSERT( std::memcmp( traits.template value< 0 >(), expected, length ) == 0 );
+}
+
+template< typename T >
+void check_roundtrip( const std::shared_ptr< tao::pq::connection >& connection, const char* type, const T v )
+{
+   const auto statement = std::string( "SELECT $1::" ) + type + "::TEXT";
+   TEST_ASSERT( connection->execute( statement.c_str(), tao::pq::binary_parameter( v ) ).template as< std::string >() == connection->execute( statement.c_str(), v ).template as< std::string >() );
+}
+
+void run()
+{
+   check( true, tao::pq::oid::bool_, "\x01", 1 );
+   check( false, tao::pq::oid::bool_, "\x00", 1 );
+   check< signed char >( -2, tao::pq::oid::int2, "\xff\xfe", 2 );
+   check< unsigned char >( 255, tao::pq::oid::int2, "\x00\xff", 2 );
+   check< short >( 258, tao::pq::oid::int2, "\x01\x02", 2 );
+   check< unsigned short >( 65535, tao::pq::oid::int4, "\x00\x00\xff\xff", 4 );
+   check( 16909060, tao::pq::oid::int4, "\x01\x02\x03\x04", 4 );
+   check( -1, tao::pq::oid::int4, "\xff\xff\xff\xff", 4 );
+   check( 4294967295U, tao::pq::oid::int8, "\x00\x00\x00\x00\xff\xff\xff\xff", 8 );
+   check( 72623859790382856LL, tao::pq::oid::int8, "\x01\x02\x03\x04\x05\x06\x07\x08", 8 );
+   check( 1.0F, tao::pq::oid::float4, "\x3f\x80\x00\x00", 4 );
+   check( -2.0, tao::pq::oid::float8, "\xc0\x00\x00\x00\x00\x00\x00\x00", 8 );
+
+   {
+      std::string data;
+      tao::pq::parameter_traits< tao::pq::binary_parameter< int > >( tao::pq::binary_parameter( 42 ) ).element< 0 >( data );
+      TEST_ASSERT( data == "42" );
+   }
+
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   check_roundtrip( connection, "BOOLEAN", true );
+   check_roundtrip( connection, "SMALLINT", static_cast< short >( -12345 ) );
+   check_roundtrip( connection, "INTEGER", std::numeric_limits< int >::min() );
+   check_roundtrip( connection, "BIGINT", std::numeric_limits< long long >::max() );
+   check_roundtrip( connection, "BIGINT", std::numeric_limits< unsigned int >::max() );
+   check_roundtrip( connection, "REAL", 0.1F );
+   check_roundtrip( connection, "DOUBLE PRECISION", 0.1 );
+   check_roundtrip( connection, "DOUBLE PRECISION", std::numeric_limits< double >::infinity() );
+
+   // no implicit casts for binary parameters
+   TEST_THROWS( connection->execute( "SELECT $1::INTEGER", tao::pq::binary_parameter( 1.5 ) ) );
+
+   const std::optional< tao::pq::binary_parameter< int > > empty;
+   TEST_ASSERT( connection->execute( "SELECT $1::INTEGER IS NULL", empty ).as< bool >() );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
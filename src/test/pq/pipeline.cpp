@@ -0,0 +1,88 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   connection->execute( "DROP TABLE IF EXISTS tao_pipeline_test" );
+   connection->execute( "CREATE TABLE tao_pipeline_test ( a INTEGER PRIMARY KEY, b TEXT NOT NULL )" );
+   connection->prepare( "insert_pipeline", "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )" );
+
+   TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+   {
+      tao::pq::pipeline pl( connection->direct() );
+      TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::on );
+      TEST_THROWS( connection->direct() );
+      for( int n = 0; n < 50; ++n ) {
+         pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", n, "EUR" );
+      }
+      pl.sync();
+      pl.send( "insert_pipeline", 50, "USD" );
+      pl.send( "SELECT COUNT(*) FROM tao_pipeline_test" );
+      const auto results = pl.finish();
+      TEST_ASSERT( results.size() == 52 );
+      TEST_ASSERT( results[ 0 ].rows_affected() == 1 );
+      TEST_ASSERT( results[ 50 ].rows_affected() == 1 );
+      TEST_ASSERT( results[ 51 ].as< int >() == 51 );
+   }
+   TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+   TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_pipeline_test" ).as< int >() == 51 );
+
+   {
+      const auto tr = connection->transaction();
+      tao::pq::pipeline pl( tr );
+      TEST_THROWS( tr->execute( "SELECT 42" ) );
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 100, "EUR" );
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 100, "EUR" );
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 101, "EUR" );
+      TEST_THROWS( pl.finish() );
+   }
+   TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+   TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_pipeline_test" ).as< int >() == 51 );
+
+   {
+      // statements which were not synchronized are abandoned when the pipeline is not finished
+      tao::pq::pipeline pl( connection->direct() );
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 200, "EUR" );
+   }
+   TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+   TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_pipeline_test" ).as< int >() == 51 );
+
+   {
+      // statements before a synchronization point are kept
+      tao::pq::pipeline pl( connection->direct() );
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 201, "EUR" );
+      pl.sync();
+      pl.send( "INSERT INTO tao_pipeline_test VALUES ( $1, $2 )", 202, "EUR" );
+   }
+   TEST_ASSERT( connection->pipeline_status() == tao::pq::pipeline_status::off );
+   TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_pipeline_test" ).as< int >() == 52 );
+   TEST_ASSERT( connection->execute( "SELECT COUNT(*) FROM tao_pipeline_test WHERE a = 202" ).as< int >() == 0 );
+
+   TEST_THROWS( connection->pipeline_sync() );
+
+   connection->execute( "DROP TABLE tao_pipeline_test" );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
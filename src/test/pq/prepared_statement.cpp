@@ -0,0 +1,86 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+
+// arguments are not narrowed to the declared parameter types
+static_assert( tao::pq::internal::is_non_narrowing< long long, int > );
+static_assert( tao::pq::internal::is_non_narrowing< int, const int& > );
+static_assert( tao::pq::internal::is_non_narrowing< double, float > );
+static_assert( tao::pq::internal::is_non_narrowing< std::string, const char( & )[ 4 ] > );
+static_assert( !tao::pq::internal::is_non_narrowing< short, int > );
+static_assert( !tao::pq::internal::is_non_narrowing< unsigned, int > );
+static_assert( !tao::pq::internal::is_non_narrowing< float, double > );
+static_assert( !tao::pq::internal::is_non_narrowing< bool, int > );
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   connection->execute( "DROP TABLE IF EXISTS tao_prepared_statement_test" );
+   connection->execute( "CREATE TABLE tao_prepared_statement_test ( a INT2, b INT4, c INT8, d FLOAT4, e FLOAT8, f BOOLEAN, g TEXT )" );
+
+   const auto insert = connection->prepare< int, int, long long, float, double, bool, std::string >( "insert_all", "INSERT INTO tao_prepared_statement_test VALUES ( $1, $2, $3, $4, $5, $6, $7 )" );
+   TEST_ASSERT( insert.name() == "insert_all" );
+   TEST_ASSERT( insert.parameters() == 7 );
+   TEST_ASSERT( insert.types()[ 0 ] == static_cast< Oid >( tao::pq::oid::int2 ) );
+   TEST_ASSERT( insert.types()[ 4 ] == static_cast< Oid >( tao::pq::oid::float8 ) );
+
+   connection->execute( insert, 1, 2, 3, 1.5F, 2.5, true, "foo" );
+   connection->execute( insert, -1, -2, -3, -1.5F, -2.5, false, std::string( "bar" ) );
+
+   // values that do not fit the described type are sent as text and rejected by the server
+   TEST_THROWS( connection->execute( insert, 100000, 2, 3, 1.5F, 2.5, true, "foo" ) );
+
+   // the name can still be used directly
+   connection->execute( "insert_all", 5, 6, 7, 8.5, 9.5, true, "baz" );
+
+   const auto select = connection->prepare< int >( "select_row", "SELECT b, c, d, e, f, g FROM tao_prepared_statement_test WHERE a = $1" );
+   TEST_ASSERT( ( connection->execute( select, 1 ).tuple< int, long long, float, double, bool, std::string >() == std::make_tuple( 2, 3LL, 1.5F, 2.5, true, std::string( "foo" ) ) ) );
+   TEST_ASSERT( ( connection->execute( select, -1 ).tuple< int, long long, float, double, bool, std::string >() == std::make_tuple( -2, -3LL, -1.5F, -2.5, false, std::string( "bar" ) ) ) );
+
+   const auto count = connection->prepare<>( "count_rows", "SELECT COUNT(*) FROM tao_prepared_statement_test" );
+   TEST_ASSERT( count.parameters() == 0 );
+   TEST_ASSERT( connection->execute( count ).as< int >() == 3 );
+
+   {
+      const auto tr = connection->transaction();
+      tr->execute( insert, 10, 11, 12, 13.5F, 14.5, false, "qux" );
+      TEST_ASSERT( tr->execute( count ).as< int >() == 4 );
+      tr->rollback();
+   }
+   TEST_ASSERT( connection->execute( count ).as< int >() == 3 );
+
+   // the number of parameters is checked against the server's description
+   TEST_THROWS( connection->prepare< int >( "mismatch", "SELECT $1::INTEGER + $2::INTEGER" ) );
+   TEST_THROWS( connection->deallocate( "mismatch" ) );
+
+   // unsigned and text parameters
+   const auto add = connection->prepare< unsigned, std::string >( "add", "SELECT $1::INT8 + $2::INT8" );
+   TEST_ASSERT( connection->execute( add, 4000000000U, "1" ).as< long long >() == 4000000001LL );
+
+   connection->deallocate( "insert_all" );
+   TEST_THROWS( connection->execute( insert, 1, 2, 3, 1.5F, 2.5, true, "foo" ) );
+
+   connection->execute( "DROP TABLE tao_prepared_statement_test" );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
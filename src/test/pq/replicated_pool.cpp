@@ -0,0 +1,91 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <chrono>
+
+#include <tao/pq/replicated_pool.hpp>
+
+void run()
+{
+   // overwrite the default with an environment variable if needed
+   const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+
+   const auto pool = tao::pq::replicated_pool::create( connection_string, { connection_string, connection_string } );
+   TEST_ASSERT( pool->replicas().size() == 2 );
+
+   TEST_ASSERT( pool->execute( "SELECT 1" ).as< int >() == 1 );
+   TEST_ASSERT( pool->primary()->idle() == 1 );
+
+   {
+      const auto tr = pool->transaction( tao::pq::access_mode::read_only );
+      TEST_ASSERT( tr->execute( "SELECT 2" ).as< int >() == 2 );
+      TEST_THROWS( tr->execute( "CREATE TEMPORARY TABLE tao_replicated_pool_test ( a INTEGER )" ) );
+   }
+   TEST_ASSERT( pool->primary()->size() == 1 );
+
+   {
+      // the least loaded replica is used
+      const auto c1 = pool->replica_connection();
+      const auto c2 = pool->replica_connection();
+      TEST_ASSERT( pool->replicas()[ 0 ]->in_use() == 1 );
+      TEST_ASSERT( pool->replicas()[ 1 ]->in_use() == 1 );
+      const auto c3 = pool->replica_connection();
+      TEST_ASSERT( pool->replicas()[ 0 ]->in_use() + pool->replicas()[ 1 ]->in_use() == 3 );
+   }
+
+   {
+      const auto tr = pool->transaction( tao::pq::isolation_level::serializable );
+      TEST_ASSERT( pool->primary()->in_use() == 1 );
+      tr->execute( "CREATE TEMPORARY TABLE tao_replicated_pool_test ( a INTEGER )" );
+      tr->commit();
+   }
+
+   const auto single = tao::pq::replicated_pool::create( connection_string, {}, 1 );
+   {
+      const auto tr = single->transaction( tao::pq::access_mode::read_only );
+      TEST_ASSERT( single->primary()->in_use() == 1 );
+   }
+
+   const auto broken = tao::pq::replicated_pool::create( connection_string, { "dbname=DOES_NOT_EXIST", connection_string } );
+   TEST_ASSERT( broken->replica_connection()->execute( "SELECT 3" ).as< int >() == 3 );
+   TEST_ASSERT( broken->replica_connection()->execute( "SELECT 4" ).as< int >() == 4 );
+
+   const auto unreachable = tao::pq::replicated_pool::create( connection_string, { "dbname=DOES_NOT_EXIST" } );
+   TEST_THROWS( unreachable->replica_connection() );
+   TEST_THROWS( unreachable->replica_connection() );
+   unreachable->set_backoff( std::chrono::seconds( 0 ) );
+   TEST_THROWS( unreachable->replica_connection() );
+
+   {
+      // an unreachable replica costs one connect timeout, afterwards it is skipped
+      const auto partial = tao::pq::replicated_pool::create( connection_string, { "host=10.255.255.1 connect_timeout=1", connection_string } );
+      TEST_ASSERT( partial->backoff() > std::chrono::seconds( 5 ) );
+      const auto start = std::chrono::steady_clock::now();
+      for( int i = 0; i < 10; ++i ) {
+         TEST_ASSERT( partial->replica_connection()->execute( "SELECT 5" ).as< int >() == 5 );
+      }
+      TEST_ASSERT( std::chrono::steady_clock::now() - start < std::chrono::seconds( 5 ) );
+      TEST_ASSERT( partial->replicas()[ 0 ]->size() == 0 );
+   }
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
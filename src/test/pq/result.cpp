@@ -157,6 +157,31 @@ void run()  // NOLINT(readability-function-size)
       }
    }
    TEST_ASSERT( count == 2 );
+
+   {
+      const auto columnar = connection->execute( "SELECT * FROM ( VALUES ( 1, 1.5, 'a' ), ( 2, NULL, 'b' ), ( 3, 3.5, NULL ) ) AS t ( i, d, s )" );
+      const auto [ i, d, s ] = columnar.columns< int, std::optional< double >, std::optional< std::string > >();
+      TEST_ASSERT( ( i == std::vector< int >{ 1, 2, 3 } ) );
+      TEST_ASSERT( d.size() == 3 );
+      TEST_ASSERT( d[ 0 ] == 1.5 );
+      TEST_ASSERT( !d[ 1 ] );
+      TEST_ASSERT( d[ 2 ] == 3.5 );
+      TEST_ASSERT( s[ 1 ] == "b" );
+      TEST_ASSERT( !s[ 2 ] );
+      TEST_ASSERT( ( columnar.null_bitmap( 1 ) == std::vector< bool >{ false, true, false } ) );
+      TEST_ASSERT( ( columnar.column< long long >( "i" ) == std::vector< long long >{ 1, 2, 3 } ) );
+      TEST_THROWS( columnar.column< double >( 1 ) );
+      TEST_THROWS( columnar.column< int >( 3 ) );
+      TEST_THROWS( columnar.null_bitmap( 3 ) );
+      TEST_THROWS( columnar.columns< int, double >() );
+      TEST_ASSERT( connection->execute( "SELECT 1 WHERE FALSE" ).column< int >( 0 ).empty() );
+      TEST_THROWS( connection->execute( "SET search_path TO public" ).column< int >( 0 ) );
+
+      connection->set_result_format( tao::pq::result_format::binary_format );
+      const auto binary = connection->execute( "SELECT * FROM ( VALUES ( 1::INTEGER ), ( 2 ), ( NULL ) ) AS t ( i )" );
+      TEST_ASSERT( ( binary.column< std::optional< int > >( 0 ) == std::vector< std::optional< int > >{ 1, 2, std::nullopt } ) );
+      connection->set_result_format( tao::pq::result_format::text_format );
+   }
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
@@ -0,0 +1,98 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <limits>
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   static_assert( tao::pq::result_traits_has_binary< int > );
+   static_assert( tao::pq::result_traits_has_binary< std::optional< double > > );
+   static_assert( !tao::pq::result_traits_has_binary< std::vector< int > > );
+
+   TEST_ASSERT( tao::pq::result_traits< bool >::from_binary( "\x01", 1, tao::pq::oid::bool_ ) );
+   TEST_ASSERT( !tao::pq::result_traits< bool >::from_binary( "\x00", 1, tao::pq::oid::bool_ ) );
+   TEST_THROWS( tao::pq::result_traits< bool >::from_binary( "\x00\x01", 2, tao::pq::oid::int2 ) );
+
+   TEST_ASSERT( tao::pq::result_traits< short >::from_binary( "\xff\xfe", 2, tao::pq::oid::int2 ) == -2 );
+   TEST_ASSERT( tao::pq::result_traits< int >::from_binary( "\x01\x02\x03\x04", 4, tao::pq::oid::int4 ) == 16909060 );
+   TEST_ASSERT( tao::pq::result_traits< long long >::from_binary( "\x01\x02\x03\x04\x05\x06\x07\x08", 8, tao::pq::oid::int8 ) == 72623859790382856LL );
+   TEST_ASSERT( tao::pq::result_traits< long long >::from_binary( "\x00\x2a", 2, tao::pq::oid::int2 ) == 42 );
+   TEST_THROWS( tao::pq::result_traits< short >::from_binary( "\x00\x01\x00\x00", 4, tao::pq::oid::int4 ) );
+   TEST_THROWS( tao::pq::result_traits< unsigned >::from_binary( "\xff\xff\xff\xff", 4, tao::pq::oid::int4 ) );
+   TEST_THROWS( tao::pq::result_traits< int >::from_binary( "\x3f\x80\x00\x00", 4, tao::pq::oid::float4 ) );
+
+   TEST_ASSERT( tao::pq::result_traits< float >::from_binary( "\x3f\x80\x00\x00", 4, tao::pq::oid::float4 ) == 1.0F );
+   TEST_ASSERT( tao::pq::result_traits< double >::from_binary( "\xc0\x00\x00\x00\x00\x00\x00\x00", 8, tao::pq::oid::float8 ) == -2.0 );
+   TEST_THROWS( tao::pq::result_traits< double >::from_binary( "\x00\x00\x00\x01", 4, tao::pq::oid::int4 ) );
+
+   TEST_ASSERT( tao::pq::result_traits< std::string >::from_binary( "a\0b", 3, tao::pq::oid::text ) == std::string( "a\0b", 3 ) );
+   TEST_ASSERT( tao::pq::result_traits< std::string >::from_binary( "ab", 2, tao::pq::oid::varchar ) == "ab" );
+   TEST_ASSERT( tao::pq::result_traits< std::string_view >::from_binary( "ab", 2, tao::pq::oid::bpchar ) == "ab" );
+   TEST_ASSERT( tao::pq::result_traits< const char* >::from_binary( "ab", 2, tao::pq::oid::name ) == std::string( "ab" ) );
+   TEST_THROWS( tao::pq::result_traits< std::string >::from_binary( "\x00\x00\x00\x01", 4, tao::pq::oid::int4 ) );
+   TEST_THROWS( tao::pq::result_traits< std::string_view >::from_binary( "\x00\x00\x00\x01", 4, tao::pq::oid::int4 ) );
+   TEST_THROWS( tao::pq::result_traits< const char* >::from_binary( "\x00\x00\x00\x01", 4, tao::pq::oid::int4 ) );
+   TEST_ASSERT( tao::pq::result_traits< char >::from_binary( "x", 1, tao::pq::oid::char_ ) == 'x' );
+   TEST_ASSERT( tao::pq::result_traits< char >::from_binary( "x", 1, tao::pq::oid::text ) == 'x' );
+   TEST_THROWS( tao::pq::result_traits< char >::from_binary( "\x01", 1, tao::pq::oid::bool_ ) );
+   TEST_ASSERT( tao::pq::result_traits< tao::pq::binary >::from_binary( "\x01\x02", 2, tao::pq::oid::bytea ).size() == 2 );
+   TEST_THROWS( tao::pq::result_traits< tao::pq::binary >::from_binary( "\x00\x00\x00\x01", 4, tao::pq::oid::int4 ) );
+   TEST_THROWS( tao::pq::result_traits< std::basic_string< unsigned char > >::from_binary( "ab", 2, tao::pq::oid::text ) );
+
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+   TEST_ASSERT( connection->result_format() == tao::pq::result_format::text_format );
+   connection->set_result_format( tao::pq::result_format::binary_format );
+   TEST_ASSERT( connection->result_format() == tao::pq::result_format::binary_format );
+
+   {
+      const auto result = connection->execute( "SELECT 42::SMALLINT, 4242::INTEGER, 424242::BIGINT, 1.5::REAL, 2.5::DOUBLE PRECISION, TRUE, 'foo'::TEXT, '\\x0102'::BYTEA, NULL::INTEGER" );
+      TEST_ASSERT( result.is_binary( 0 ) );
+      TEST_ASSERT( result.type( 1 ) == tao::pq::oid::int4 );
+      TEST_ASSERT( result.length( 0, 2 ) == 8 );
+      const auto row = result[ 0 ];
+      TEST_ASSERT( row[ 0 ].as< int >() == 42 );
+      TEST_ASSERT( row[ 1 ].as< long >() == 4242 );
+      TEST_ASSERT( row[ 2 ].as< long long >() == 424242 );
+      TEST_ASSERT( row[ 3 ].as< float >() == 1.5F );
+      TEST_ASSERT( row[ 4 ].as< double >() == 2.5 );
+      TEST_ASSERT( row[ 5 ].as< bool >() );
+      TEST_ASSERT( row[ 6 ].as< std::string >() == "foo" );
+      TEST_ASSERT( row[ 7 ].as< tao::pq::binary >() == tao::pq::to_binary( "\x01\x02", 2 ) );
+      TEST_THROWS( row[ 1 ].as< tao::pq::binary >() );
+      TEST_ASSERT( !row[ 8 ].as< std::optional< int > >() );
+      TEST_ASSERT( row.tuple< short, int >() == std::tuple< short, int >( 42, 4242 ) );
+      TEST_THROWS( row[ 2 ].as< short >() );
+      TEST_THROWS( row[ 4 ].as< int >() );
+      TEST_THROWS( row[ 1 ].as< std::string >() );
+      TEST_THROWS( row[ 1 ].as< std::string_view >() );
+   }
+
+   TEST_ASSERT( connection->execute( "SELECT $1::BIGINT", std::numeric_limits< long long >::min() ).as< long long >() == std::numeric_limits< long long >::min() );
+   TEST_THROWS( connection->execute( "SELECT ARRAY[ 1, 2 ]" ).as< std::vector< int > >() );
+
+   connection->set_result_format( tao::pq::result_format::text_format );
+   TEST_ASSERT( !connection->execute( "SELECT 42" ).is_binary( 0 ) );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
@@ -6,6 +6,7 @@
 #include "../macros.hpp"
 
 #include <tao/pq/connection.hpp>
+#include <tao/pq/result_traits_array.hpp>
 #include <tao/pq/result_traits_optional.hpp>
 #include <tao/pq/result_traits_pair.hpp>
 #include <tao/pq/result_traits_tuple.hpp>
@@ -59,6 +60,19 @@ void run()
    TEST_THROWS( row.index( "\"c\"" ) );
    TEST_ASSERT( row.index( "\"C\"" ) == 2 );
 
+   const tao::pq::column_ref a( "a" );
+   const tao::pq::column_ref quoted_a( "\"A\"" );
+   const tao::pq::column_ref c( "C" );
+   TEST_ASSERT( row.index( a ) == 0 );
+   TEST_ASSERT( row.index( quoted_a ) == 3 );
+   TEST_THROWS( row.index( c ) );
+   TEST_ASSERT( row[ a ].as< int >() == 1 );
+   TEST_ASSERT( row.at( quoted_a ).as< int >() == 4 );
+   TEST_THROWS( row.at( c ) );
+   TEST_ASSERT( result.index( tao::pq::column_ref( "\"C\"" ) ) == 2 );
+   TEST_ASSERT( ( result.column< int >( a ) == std::vector< int >{ 1 } ) );
+   TEST_THROWS( connection->execute( "SET search_path TO public" ).index( a ) );
+
    TEST_THROWS( row.get< std::string >( 4 ) );
    TEST_THROWS( row.get< std::optional< std::string > >( 4 ) );
    TEST_THROWS( row.get< std::pair< std::string, std::string > >( 3 ) );
@@ -75,6 +89,8 @@ void run()
    TEST_THROWS( row2.slice( 1, 1 ).index( "A" ) );
    TEST_THROWS( row2.slice( 2, 1 ).index( "b" ) );
    TEST_THROWS( row2.slice( 2, 1 ).index( "B" ) );
+   TEST_ASSERT( row2.slice( 1, 2 ).index( a ) == 1 );
+   TEST_THROWS( row2.slice( 1, 1 ).index( a ) );
 
    TEST_THROWS( row2.slice( 0, 0 ) );
    TEST_THROWS( row2.slice( 1, 0 ) );
@@ -83,6 +99,32 @@ void run()
    TEST_THROWS( row2.slice( 0, 4 ) );
    TEST_THROWS( row2.slice( 1, 3 ) );
    TEST_THROWS( row2.slice( 2, 2 ) );
+
+   const auto result3 = connection->execute( "SELECT * FROM ( VALUES ( 1, 'a' ), ( 2, NULL ) ) AS t ( i, s )" );
+   TEST_ASSERT( result3[ 0 ].get_unchecked< int >( 0 ) == 1 );
+   TEST_ASSERT( result3[ 1 ].get_unchecked< std::optional< std::string > >( 1 ) == std::nullopt );
+   TEST_ASSERT( result3[ 0 ].get_unchecked( 1 ) == std::string( "a" ) );
+   TEST_ASSERT( !result3[ 0 ].is_null_unchecked( 1 ) );
+   TEST_ASSERT( result3[ 1 ].is_null_unchecked( 1 ) );
+   TEST_THROWS( result3[ 1 ].get_unchecked< std::string >( 1 ) );
+   TEST_THROWS( result3[ 2 ].get< int >( 0 ) );
+   TEST_THROWS( result3[ 1 ].get< std::string >( 1 ) );
+
+   int sum = 0;
+   for( const auto& r : result3 ) {
+      sum += r.get_unchecked< int >( 0 );
+   }
+   TEST_ASSERT( sum == 3 );
+
+   TEST_ASSERT( result3.vector< std::pair< int, std::optional< std::string > > >().size() == 2 );
+   TEST_THROWS( result3.vector< int >() );
+   TEST_THROWS( result3.vector< std::pair< int, std::string > >() );
+
+   connection->set_result_format( tao::pq::result_format::binary_format );
+   TEST_ASSERT( connection->execute( "SELECT 42::INTEGER" )[ 0 ].get_unchecked< int >( 0 ) == 42 );
+   TEST_THROWS( connection->execute( "SELECT ARRAY[ 1, 2 ]" ).vector< std::vector< int > >() );
+   TEST_THROWS( connection->execute( "SELECT ARRAY[ 1, 2 ]" )[ 0 ].get_unchecked< std::vector< int > >( 0 ) );
+   connection->set_result_format( tao::pq::result_format::text_format );
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)
@@ -0,0 +1,101 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <tao/pq.hpp>
+
+void run()
+{
+   const auto connection = tao::pq::connection::create( tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" ) );
+
+   {
+      auto stream = connection->direct()->stream( "SELECT n, n * 2 AS m FROM generate_series( 1, $1 ) AS n", 1000 );
+      TEST_ASSERT( stream.columns() == 2 );
+      TEST_ASSERT( stream.index( "m" ) == 1 );
+      TEST_THROWS( connection->execute( "SELECT 42" ) );
+      int expected = 0;
+      for( const auto& row : stream ) {
+         ++expected;
+         TEST_ASSERT( row[ 0 ].as< int >() == expected );
+         TEST_ASSERT( row[ "m" ].as< int >() == expected * 2 );
+         TEST_ASSERT( ( row.tuple< int, int >() == std::tuple< int, int >( expected, expected * 2 ) ) );
+      }
+      TEST_ASSERT( expected == 1000 );
+      TEST_ASSERT( !stream.has_row() );
+      TEST_ASSERT( !stream.next() );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      auto stream = connection->direct()->stream( 100, "SELECT n FROM generate_series( 1, 1000 ) AS n" );
+      int sum = 0;
+      while( stream.has_row() ) {
+         sum += stream.row().as< int >();
+         (void)stream.next();
+      }
+      TEST_ASSERT( sum == 500500 );
+   }
+
+   {
+      auto stream = connection->direct()->stream( "SELECT n FROM generate_series( 1, 0 ) AS n" );
+      TEST_ASSERT( stream.columns() == 1 );
+      TEST_ASSERT( stream.begin() == stream.end() );
+   }
+
+   TEST_THROWS( connection->direct()->stream( "SELECT 1/0" ) );
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      // destroyed before reaching the end
+      auto stream = connection->direct()->stream( "SELECT n FROM generate_series( 1, 10000000 ) AS n" );
+      TEST_ASSERT( stream.row().as< int >() == 1 );
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+
+   {
+      const auto tr = connection->transaction();
+      tr->execute( "SELECT 1" );
+      {
+         auto stream = tr->stream( "SELECT n FROM generate_series( 1, 3 ) AS n" );
+         TEST_THROWS( tr->execute( "SELECT 2" ) );
+         TEST_ASSERT( stream.begin()->as< int >() == 1 );
+         while( stream.next() ) {
+         }
+      }
+      TEST_ASSERT( tr->execute( "SELECT 3" ).as< int >() == 3 );
+      tr->commit();
+   }
+
+   {
+      // destroyed before reaching the end within a transaction, which must not be aborted
+      const auto tr = connection->transaction();
+      tr->execute( "SELECT 1" );
+      {
+         auto stream = tr->stream( "SELECT n FROM generate_series( 1, 100000 ) AS n" );
+         TEST_ASSERT( stream.row().as< int >() == 1 );
+      }
+      TEST_ASSERT( tr->execute( "SELECT 3" ).as< int >() == 3 );
+      tr->commit();
+   }
+   TEST_ASSERT( connection->execute( "SELECT 42" ).as< int >() == 42 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
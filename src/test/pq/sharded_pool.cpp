@@ -0,0 +1,64 @@
+// Copyright (c) 2021 Daniel Frey and Dr. Colin Hirsch
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../getenv.hpp"
+#include "../macros.hpp"
+
+#include <string>
+#include <string_view>
+
+#include <tao/pq/sharded_pool.hpp>
+
+void run()
+{
+   // overwrite the default with an environment variable if needed
+   const auto connection_string = tao::pq::internal::getenv( "TAOPQ_TEST_DATABASE", "dbname=template1" );
+
+   TEST_THROWS( tao::pq::sharded_pool::create( {} ) );
+   TEST_THROWS( tao::pq::sharded_pool::create( { connection_string }, nullptr ) );
+
+   const auto pool = tao::pq::sharded_pool::create( { connection_string, connection_string, connection_string } );
+   TEST_ASSERT( pool->size() == 3 );
+   TEST_ASSERT( pool->shard( "tenant-1" ) < 3 );
+   TEST_ASSERT( pool->shard( "tenant-1" ) == pool->shard( "tenant-1" ) );
+   TEST_ASSERT( pool->pool( "tenant-1" ) == pool->shards()[ pool->shard( "tenant-1" ) ] );
+
+   TEST_ASSERT( pool->execute( "tenant-1", "SELECT $1::INTEGER", 1 ).as< int >() == 1 );
+   TEST_ASSERT( pool->pool( "tenant-1" )->idle() == 1 );
+   TEST_ASSERT( pool->connection( "tenant-2" )->execute( "SELECT 2" ).as< int >() == 2 );
+
+   const auto results = pool->execute_all( "SELECT $1::INTEGER + 1", 41 );
+   TEST_ASSERT( results.size() == 3 );
+   for( const auto& result : results ) {
+      TEST_ASSERT( result.as< int >() == 42 );
+   }
+   for( const auto& shard : pool->shards() ) {
+      TEST_ASSERT( shard->in_use() == 0 );
+   }
+   TEST_THROWS( pool->execute_all( "SELECT * FROM tao_sharded_pool_test_does_not_exist" ) );
+
+   const auto custom = tao::pq::sharded_pool::create( { connection_string, connection_string }, []( const std::string_view key ) -> std::size_t { return key.size(); } );
+   TEST_ASSERT( custom->shard( "" ) == 0 );
+   TEST_ASSERT( custom->shard( "a" ) == 1 );
+   TEST_THROWS( custom->shard( "ab" ) );
+   TEST_ASSERT( custom->execute( "a", "SELECT 3" ).as< int >() == 3 );
+   TEST_ASSERT( custom->shards()[ 1 ]->idle() == 1 );
+}
+
+auto main() -> int  // NOLINT(bugprone-exception-escape)
+{
+   try {
+      run();
+   }
+   // LCOV_EXCL_START
+   catch( const std::exception& e ) {
+      std::cerr << "exception: " << e.what() << std::endl;
+      throw;
+   }
+   catch( ... ) {
+      std::cerr << "unknown exception" << std::endl;
+      throw;
+   }
+   // LCOV_EXCL_STOP
+}
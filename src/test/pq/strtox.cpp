@@ -101,6 +101,16 @@ void run()
    TEST_ASSERT( tao::pq::internal::strtof( "inf" ) > 0 );
    TEST_ASSERT( tao::pq::internal::strtof( "-inf" ) < 0 );
 
+   TEST_ASSERT( tao::pq::internal::strtof( "+1" ) == 1 );
+   TEST_ASSERT( tao::pq::internal::strtod( "+1.5" ) == 1.5 );
+   TEST_ASSERT( tao::pq::internal::strtod( "1e308" ) == 1e308 );
+   TEST_ASSERT( tao::pq::internal::strtod( "1.7976931348623157e308" ) == 1.7976931348623157e308 );
+   TEST_ASSERT( tao::pq::internal::strtod( "2.2250738585072014e-308" ) == 2.2250738585072014e-308 );
+   TEST_ASSERT( tao::pq::internal::strtod( "0.1" ) == 0.1 );
+   TEST_ASSERT( tao::pq::internal::strtod( "-1.2345678901234567e-5" ) == -1.2345678901234567e-5 );
+   TEST_ASSERT( tao::pq::internal::strtof( "3.4028235e38" ) == 3.4028235e38F );
+   TEST_ASSERT( tao::pq::internal::strtof( "1.1754944e-38" ) == 1.1754944e-38F );
+
    reject_floating_point< std::runtime_error >( "" );
    reject_floating_point< std::runtime_error >( " " );
    reject_floating_point< std::runtime_error >( "+" );
@@ -115,6 +125,20 @@ void run()
    reject_floating_point< std::overflow_error >( "-1e10000" );
    reject_floating_point< std::underflow_error >( "1e-10000" );
    reject_floating_point< std::underflow_error >( "-1e-10000" );
+
+   // subnormal results are rejected independent of std::from_chars() being available
+   try {
+      (void)tao::pq::internal::strtod( "1e-310" );
+      throw std::runtime_error( "strtod(): 1e-310" );  // LCOV_EXCL_LINE
+   }
+   catch( const std::overflow_error& /*unused*/ ) {
+   }
+   try {
+      (void)tao::pq::internal::strtof( "1e-40" );
+      throw std::runtime_error( "strtof(): 1e-40" );  // LCOV_EXCL_LINE
+   }
+   catch( const std::overflow_error& /*unused*/ ) {
+   }
 }
 
 auto main() -> int  // NOLINT(bugprone-exception-escape)